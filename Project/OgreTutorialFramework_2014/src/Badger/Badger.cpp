@@ -10,10 +10,18 @@
 
 // Engine headers.
 #include <Badger/HandleBar.h>
-#include <Badger/LuggageRack.h>
 #include <Badger/Wheel.h>
 #include <Framework/OgreApplication.h>
+#include <Misc/Profiler.h>
+#include <Misc/StateBuffer.h>
 #include <Utility/Maths.h>
+#include <Utility/Ogre.h>
+
+
+
+// Globals.
+const Ogre::String      chassisMesh         { "BadgerChassis" };        //!< The chassis merged with every rigid part, this is built once and shared.
+const Ogre::Vector3     luggageRackOffset   { 0.f, 0.018f, -0.024f };   //!< The position of the luggage rack relative to the chassis.
 
 
 
@@ -36,20 +44,18 @@ Badger& Badger::operator= (Badger&& move)
     {
         // IActor.
         m_node = std::move (move.m_node);
+        m_position = std::move (move.m_position);
+        m_orientation = std::move (move.m_orientation);
+        m_scale = std::move (move.m_scale);
+        m_previousPosition = std::move (move.m_previousPosition);
+        m_previousOrientation = std::move (move.m_previousOrientation);
         
         // Badger.
         m_handleBar = std::move (move.m_handleBar);
-        m_luggageRack = std::move (move.m_luggageRack);
         m_wheels = std::move (move.m_wheels);
 
-        m_wheelBase = std::move (move.m_wheelBase);
-
-        m_acceleration = std::move (move.m_acceleration);
-        m_brakePower = std::move (move.m_brakePower);
-        
-        m_currentSpeed = std::move (move.m_currentSpeed);
-        m_maxSpeed = std::move (move.m_maxSpeed);
-        m_targetSpeedRate = std::move (move.m_targetSpeedRate);
+        m_model = std::move (move.m_model);
+        m_vehicle = std::move (move.m_vehicle);
     }
 
     return *this;
@@ -65,9 +71,12 @@ Badger::~Badger()
 
 #pragma region Getters and setters
 
-float Badger::getTurnLimitRadians() const
+void Badger::setVehicleState (const VehicleState& state)
 {
-    return m_handleBar->getTurnLimitRadians();
+    m_vehicle = state;
+
+    mirrorChassis();
+    mirrorComponents();
 }
 
 
@@ -76,34 +85,26 @@ void Badger::setSpeedRate (const float speed)
     // Clamp the given speed rate and then scale it to between 0.f and 1.f.
     const float min { -1.f }, max { 1.f };
 
-    m_targetSpeedRate = util::clamp (speed, min, max);
+    m_vehicle.targetSpeedRate = util::clamp (speed, min, max);
 }
 
 
 void Badger::setTurnRate (const float turn)
 {
-    // Clamp the given turn rate.
-    const float min         { -1.f }, max { 1.f },
-                clampedTurn { util::clamp (turn, min, max) };
-    
-    // Ensure the handle bar follows the wheels.
-    m_handleBar->setTargetTurn (clampedTurn);
-    
-    // Only update the first two wheels.
-    if (m_wheels.size() >= 2)
-    {
-        m_wheels[0]->setTargetTurn (clampedTurn);
-        m_wheels[1]->setTargetTurn (clampedTurn);
-    }
+    // Clamp the given turn rate, the handle bars and front wheels will follow it as the model steers.
+    const float min { -1.f }, max { 1.f };
+
+    m_vehicle.targetTurn = util::clamp (turn, min, max);
 }
 
 
 void Badger::reset()
 {
-    // Reset the badger itself.
-    m_node->setPosition ({ 0.f, 4.f, 0.f });
-    m_node->setOrientation ({ });
-    m_node->setScale ({ 200.f, 200.f, 200.f });
+    // Reset the simulated state, this places the badger stationary at its starting point.
+    m_vehicle = VehicleState();
+    m_vehicle.y = 4.f;
+
+    setScale ({ 200.f, 200.f, 200.f });
 
     // Reset the handle bar.
     m_handleBar->reset();
@@ -116,9 +117,12 @@ void Badger::reset()
 
     setupWheels();
 
-    // Reset our speed.
-    m_currentSpeed = 0.f;
-    m_targetSpeedRate = 0.f;
+    // Now everything is in place the state can be mirrored.
+    mirrorChassis();
+    mirrorComponents();
+
+    // Any previous transforms are no longer valid.
+    clearInterpolation();
 }
 
 #pragma endregion
@@ -130,19 +134,29 @@ bool Badger::initialise (OgreApplication* const ogre, Ogre::SceneNode* const roo
 {
     try
     {
-        // Pre-condition: We have a valid OgreApplication and SceneNode pointer.
-        if (!ogre || !root)
+        // Pre-condition: We have a valid SceneNode pointer. A nullptr OgreApplication creates a headless actor.
+        if (!root)
         {
-            throw std::invalid_argument ("Badger::initialise(), required parameter 'ogre' or 'root' is a nullptr.");
+            throw std::invalid_argument ("Badger::initialise(), required parameter 'root' is a nullptr.");
         }    
         
         // Ensure we allocate all the required memory to speed up intialisation.
 	    m_wheels.resize (4);
         
+        // The luggage rack never moves relative to the chassis so it's merged in, saving a node, an entity and a batch per badger.
+        const bool merged { util::mergeMeshes (ogre, chassisMesh, { { "chassis.mesh", Ogre::Vector3::ZERO }, { "luggage_rack.mesh", luggageRackOffset } }, "green") };
+
         // Load the chasis.
-        const auto entity = constructEntity (ogre, "chassis.mesh");
+        const auto entity = constructEntity (ogre, merged ? chassisMesh : "chassis.mesh");
         m_node = constructNode (root, name, entity);
 
+        // The null render backend can't merge meshes so the luggage rack is drawn separately, it still never moves.
+        if (ogre && !merged)
+        {
+            const auto luggageRack = m_node->createChildSceneNode (name + "-LuggageRack", luggageRackOffset);
+            luggageRack->attachObject (constructEntity (ogre, "luggage_rack.mesh"));
+        }
+
         // Load the child nodes.
         createChildren (ogre, name);
 
@@ -169,141 +183,123 @@ bool Badger::initialise (OgreApplication* const ogre, Ogre::SceneNode* const roo
 
 void Badger::updateSimulation (const float deltaTime)
 {
-    // Ensure we have correct speed values.
-    updateSpeed (deltaTime);
-
-    // Calculate the distance to travel. We don't take the badgers scale into account, instead we assume the model and speed values have been scaled correctly.
-    const float distance    { m_currentSpeed * deltaTime };
+    PROFILE_SCOPE ("Badger::updateSimulation");
 
-    // Simulate the badgers movement and rotation.
-    moveForward (distance);
-    rotate (distance);
+    // We don't take the badgers scale into account, instead we assume the model and speed values have been scaled correctly.
+    m_model.step (m_vehicle, deltaTime);
 
-    // Update each component. We can ignore the luggage rack.
-    m_handleBar->updateSimulation (deltaTime);
-    
-    for (auto& wheel : m_wheels)
-    {
-        wheel->updateSimulation (deltaTime);
-    }
+    // The components don't simulate themselves, they simply display the state.
+    mirrorChassis();
+    mirrorComponents();
 }
 
 #pragma endregion
 
 
-#pragma region External simulation
+#pragma region Interpolation
 
-void Badger::revolveWheels (const float distance)
+void Badger::beginStep()
 {
-    // Inform each wheel that it needs to revolve.
+    IActor::beginStep();
+    m_handleBar->beginStep();
+
     for (auto& wheel : m_wheels)
     {
-        wheel->revolve (distance);
+        wheel->beginStep();
     }
 }
 
-#pragma endregion
 
+void Badger::interpolate (const float alpha)
+{
+    IActor::interpolate (alpha);
+    m_handleBar->interpolate (alpha);
+
+    for (auto& wheel : m_wheels)
+    {
+        wheel->interpolate (alpha);
+    }
+}
 
-#pragma region Simulation
 
-void Badger::updateSpeed (const float deltaTime)
+void Badger::clearInterpolation()
 {
-    // Calculate whether we've reached our target speed.
-    const float currentSpeedRate    { m_currentSpeed / m_maxSpeed };
+    IActor::clearInterpolation();
+    m_handleBar->clearInterpolation();
 
-    if (!util::roughlyEquals (currentSpeedRate, m_targetSpeedRate, 0.001f))
+    for (auto& wheel : m_wheels)
     {
-        // The modifier decides if we use negative or positive speed increases.
-        const float modifier            { m_targetSpeedRate > currentSpeedRate ? 1.f : -1.f };
-
-        // Create the a variable ready for calculating the increase in speed.
-        float increase = 0.f;
+        wheel->clearInterpolation();
+    }
+}
 
-        // Detect if we're supposed to be braking. Only brake if we want to swap between forward and reverse movement and vice versa.
-        if ((currentSpeedRate > 0.f && m_targetSpeedRate < 0.f) ||
-            (currentSpeedRate < 0.f && m_targetSpeedRate > 0.f))
-        {
-            // Instead of duplicating code we'll just use absolute values and take advantage of the modifier.
-            const float absSpeed        { std::abs (m_currentSpeed) };
-
-            // Calculate whether we've braked too far and therefore should use a proportion of acceleration for accurate speed.
-            const float deltaBrake      { m_brakePower * deltaTime };
-            const float brakeDifference { absSpeed - deltaBrake };
-
-            if (brakeDifference < 0.f)
-            {
-                // Calculate the proportion of acceleration speed to use.
-                const float brakeProportion { std::abs (brakeDifference / m_brakePower) };
-                const float acceleration    { m_acceleration * deltaTime * (1.f - brakeProportion) };
-
-                // The increase should be the brake speed + acceleration at the calculated proportion.
-                increase = (deltaBrake * brakeProportion + acceleration) * modifier;
-            }
-
-            else
-            {
-                // Just reduce the speed by the brake power.
-                increase = deltaBrake * modifier;
-            }
-        }
 
-        // Just increase speed to the target rate.
-        else
-        {
-            increase = m_acceleration * modifier * deltaTime;
-        }
+void Badger::publish (TransformSnapshot& snapshot) const
+{
+    IActor::publish (snapshot);
+    m_handleBar->publish (snapshot);
 
-        // Finally update our speed.
-        setCurrentSpeed (m_currentSpeed + increase);
+    for (const auto& wheel : m_wheels)
+    {
+        wheel->publish (snapshot);
     }
 }
 
+#pragma endregion
+
+
+#pragma region State
 
-void Badger::moveForward (const float distance)
+void Badger::saveState (StateBuffer& buffer) const
 {
-    // Don't waste extra computation time.
-    if (!util::roughlyEquals (distance, 0.f, 0.001f))
-    {
-        // Calculate the forward direction.
-        const auto& orientation = m_node->getOrientation();
-        const auto  forward     = orientation * Ogre::Vector3::UNIT_Z;
+    IActor::saveState (buffer);
+
+    buffer.write (m_vehicle);
 
-        // Move the badger.
-        m_node->setPosition (m_node->getPosition() + forward * distance);
+    m_handleBar->saveState (buffer);
 
-        // Revolve the wheels accordingly.
-        revolveWheels (distance);
+    for (const auto& wheel : m_wheels)
+    {
+        wheel->saveState (buffer);
     }
 }
 
 
-void Badger::rotate (const float distance)
+void Badger::restoreState (StateBuffer& buffer)
 {
-    // Calculate the angle to rotate the badger by.
-    const float angle   { distance * std::sin (m_handleBar->currentYaw()) / m_wheelBase };
+    IActor::restoreState (buffer);
 
-    // Don't waste extra computation time.
-    if (!util::roughlyEquals (angle, 0.f, 0.001f))
-    {
-        // Create the additional rotation.
-        const auto rotation = Ogre::Quaternion (Ogre::Radian (angle), Ogre::Vector3::UNIT_Y);
+    buffer.read (m_vehicle);
+
+    m_handleBar->restoreState (buffer);
 
-        // Rotate the badger.
-        m_node->rotate (rotation, Ogre::Node::TS_LOCAL);
+    for (auto& wheel : m_wheels)
+    {
+        wheel->restoreState (buffer);
     }
 }
 
 #pragma endregion
 
 
+#pragma region External simulation
+
+void Badger::revolveWheels (const float distance)
+{
+    // Only the wheels are updated, the position and heading are left as they are for whoever is controlling the badger.
+    m_model.revolve (m_vehicle, distance);
+    mirrorComponents();
+}
+
+#pragma endregion
+
+
 #pragma region Helper functions
 
 void Badger::createChildren (OgreApplication* const ogre, const Ogre::String& name)
 {
     // Create the actual data.
     m_handleBar = std::make_unique<HandleBar>();
-    m_luggageRack = std::make_unique<LuggageRack>();
 
     for (unsigned int i = 0; i < m_wheels.size(); ++i)
     {
@@ -317,11 +313,6 @@ void Badger::createChildren (OgreApplication* const ogre, const Ogre::String& na
         throw std::runtime_error ("Badger::createChildren(), the handle bars couldn't be initialised.");
     }
 
-    if (!m_luggageRack->initialise (ogre, m_node, name + "-LuggageRack"))
-    {
-        throw std::runtime_error ("Badger::createChildren(), the luggage rack couldn't be initialised.");
-    }
-
     for (unsigned int i = 0; i < m_wheels.size(); ++i)
     {
         if (!m_wheels[i]->initialise (ogre, m_node, name + "-Wheel-" + std::to_string (i)))
@@ -350,22 +341,35 @@ void Badger::setupWheels()
         if (i % 2 == 0)
         {
             m_wheels[i]->setRevolveModifier (1.f);
-            m_wheels[i]->setOrientation (leftOrientation);
+            m_wheels[i]->setBaseOrientation (leftOrientation);
         }
 
         // Right wheels needs a reverse modifier.
         else
         {
             m_wheels[i]->setRevolveModifier (-1.f);
-            m_wheels[i]->setOrientation (rightOrientation);
+            m_wheels[i]->setBaseOrientation (rightOrientation);
         }
     }
 }
 
 
-void Badger::setCurrentSpeed (const float speed)
+void Badger::mirrorChassis()
+{
+    setPosition ({ m_vehicle.x, m_vehicle.y, m_vehicle.z });
+    setOrientation ({ Ogre::Radian (m_vehicle.heading), Ogre::Vector3::UNIT_Y });
+}
+
+
+void Badger::mirrorComponents()
 {
-    m_currentSpeed = util::clamp (speed, -m_maxSpeed, m_maxSpeed);
+    m_handleBar->setSteering (m_vehicle.steering);
+
+    // Only the front wheels steer.
+    for (unsigned int i = 0; i < m_wheels.size(); ++i)
+    {
+        m_wheels[i]->setAngles (i < 2 ? m_vehicle.steering : 0.f, m_vehicle.wheelSpin);
+    }
 }
 
 #pragma endregion
\ No newline at end of file
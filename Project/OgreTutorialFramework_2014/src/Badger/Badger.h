@@ -9,11 +9,13 @@
 
 
 // Engine headers.
+#include <Badger/VehicleModel.h>
 #include <Misc/IActor.h>
 
 
 /// <summary>
-/// A simple class which represents a "Badger" vehicle in-game.
+/// A simple class which represents a "Badger" vehicle in-game. The motion is simulated by a VehicleModel and the resulting state is
+/// mirrored to the badger and its components, so moving the badger externally only lasts until the next updateSimulation().
 /// </summary>
 class Badger final : public IActor
 {
@@ -35,18 +37,30 @@ class Badger final : public IActor
         
         #pragma region Getters and setters
 
-        float getWheelBase() const              { return m_wheelBase; }
-        float getAcceleration() const           { return m_acceleration; }
-        float getBrakePower() const             { return m_brakePower; }
-        float getCurrentSpeed() const           { return m_currentSpeed; }
-        float getMaxSpeed() const               { return m_maxSpeed; }
+        float getWheelBase() const                          { return m_model.getWheelBase(); }
+        float getAcceleration() const                       { return m_model.getAcceleration(); }
+        float getBrakePower() const                         { return m_model.getBrakePower(); }
+        float getCurrentSpeed() const                       { return m_vehicle.speed; }
+        float getMaxSpeed() const                           { return m_vehicle.maxSpeed; }
 
         /// <summary> Obtains the angle limit on the turn rate of the badger. </summary>
-        float getTurnLimitRadians() const;
+        float getTurnLimitRadians() const                   { return m_model.getAngleLimit(); }
+
+        /// <summary> Gets the motion model used to simulate the badger. </summary>
+        const VehicleModel& getVehicleModel() const         { return m_model; }
+
+        /// <summary> Gets the simulated state of the badger. </summary>
+        const VehicleState& getVehicleState() const         { return m_vehicle; }
 
 
         /// <summary> Sets the maximum speed the badger can reach. </summary>
-        void setMaxSpeed (const float speed)    { m_maxSpeed = speed; }
+        void setMaxSpeed (const float speed)                { m_vehicle.maxSpeed = speed; }
+
+        /// <summary> Sets how each simulation step is integrated, a higher order integrator allows a longer step for the same accuracy. </summary>
+        void setIntegrator (const VehicleModel::Integrator integrator)  { m_model.setIntegrator (integrator); }
+
+        /// <summary> Replaces the simulated state of the badger and mirrors it immediately. </summary>
+        void setVehicleState (const VehicleState& state);
 
         /// <summary> Sets the target speed rate of the maximum speed. This will be achieved over time. </summary>
         /// <param name="speed"> This will be clamped between -1.f and 1.f. </param>
@@ -65,7 +79,7 @@ class Badger final : public IActor
                 
         /// <summary> Initialises the Badger, this will load the entire vehicle and place it at a default position. </summary>
         /// <returns> Returns whether the initialisation was successful. </returns>
-        /// <param name="ogre"> The OgreApplication used for creating entities. </param>
+        /// <param name="ogre"> The OgreApplication used for creating entities, a nullptr creates a headless Badger. </param>
         /// <param name="root"> The SceneNode to attach the Badger to. </param>
         /// <param name="name"> The unique name to give the badger. </param>
         bool initialise (OgreApplication* const ogre = nullptr, Ogre::SceneNode* const root = nullptr, const Ogre::String& name = { }) override final;
@@ -76,31 +90,46 @@ class Badger final : public IActor
 
         #pragma endregion
 
-        #pragma region External simulation
+        #pragma region Interpolation
 
-        /// <summary> Revolve the wheels by the distance given, enables external control over wheel animation. </summary>
-        /// <param name="distance"> The distance to rotate the wheels with. </param>
-        void revolveWheels (const float distance);
+        /// <summary> Prepares the badger and each moving component for a fixed simulation step. </summary>
+        void beginStep() override final;
+
+        /// <summary> Blends the badger and each moving component between the previous and current simulation steps. </summary>
+        /// <param name="alpha"> How far between the previous (0.f) and current (1.f) step to render the badger. </param>
+        void interpolate (const float alpha) override final;
+
+        /// <summary> Discards the interpolation state of the badger and each moving component. </summary>
+        void clearInterpolation() override final;
+
+        /// <summary> Publishes the transform of the badger and each moving component. </summary>
+        /// <param name="snapshot"> The snapshot being written by the simulation. </param>
+        void publish (TransformSnapshot& snapshot) const override final;
 
         #pragma endregion
 
-    private:
+        #pragma region State
 
-        #pragma region Simulation
+        /// <summary> Appends the state of the badger followed by each component. </summary>
+        /// <param name="buffer"> The buffer to append to. </param>
+        void saveState (StateBuffer& buffer) const override final;
 
-        /// <summary> Updates the current speed before simulating movement. </summary>
-        void updateSpeed (const float deltaTime);
+        /// <summary> Restores the badger and each component, the wheel setup is copied rather than recalculated. </summary>
+        /// <param name="buffer"> The buffer to read from. </param>
+        void restoreState (StateBuffer& buffer) override final;
 
-        /// <summary> Moves the badger forward according to its speed. </summary>
-        /// <param name="distance"> The distance in metres that the badger should travel. </param>
-        void moveForward (const float distance);
+        #pragma endregion
+
+        #pragma region External simulation
 
-        /// <summary> Rotates the badger according to the current wheel rotation. </summary>
-        /// <param name="distance"> The distance in metres that the badger has travelled. </param>
-        void rotate (const float distance);
+        /// <summary> Revolve the wheels by the distance given, enables external control over wheel animation. </summary>
+        /// <param name="distance"> The distance to rotate the wheels with. </param>
+        void revolveWheels (const float distance);
 
         #pragma endregion
 
+    private:
+
         #pragma region Helper functions
 
         /// <summary> Creates the actual child nodes. </summary>
@@ -109,8 +138,11 @@ class Badger final : public IActor
         /// <summary> Sets the correct position and orientation of each wheel. </summary>
         void setupWheels();
 
-        /// <summary> Sets the current speed value whilst ensuring its clamped to the max speed. </summary>
-        void setCurrentSpeed (const float speed);
+        /// <summary> Copies the simulated position and heading to the badger. </summary>
+        void mirrorChassis();
+
+        /// <summary> Copies the simulated steering and wheel spin to the handle bars and wheels. </summary>
+        void mirrorComponents();
 
         #pragma endregion
         
@@ -119,22 +151,14 @@ class Badger final : public IActor
         // Forward declarations.
         class IRotatableComponent;
         class HandleBar;
-        class LuggageRack;
         class Wheel;
 
 
         std::unique_ptr<HandleBar>          m_handleBar         { nullptr };    //!< The moving handle bars of the Badger.
-        std::unique_ptr<LuggageRack>        m_luggageRack       { nullptr };    //!< The static luggage rack of the Badger.
         std::vector<std::unique_ptr<Wheel>> m_wheels            {  };           //!< The four wheels of the Badger, front wheels come first.
         
-        float                               m_wheelBase         { 8.f };        //!< The length between the front and rear wheels.
-
-        float                               m_acceleration      { 15.f };       //!< How quickly the badger can change its current speed.
-        float                               m_brakePower        { 100.f };       //!< How quickly the badger can break.
-        
-        float                               m_currentSpeed      { 0.f };        //!< Keeps track of how quickly the badger is currently moving.
-        float                               m_maxSpeed          { 80.f };       //!< The vehicle speed in meters per second.
-        float                               m_targetSpeedRate   { 0.f };        //!< A normalised value between -1.f and 1.f which represents the desired max speed value.
+        VehicleModel                        m_model             {  };           //!< The motion model, including the wheel base, acceleration and brake power.
+        VehicleState                        m_vehicle           {  };           //!< The simulated state which is mirrored to the nodes.
 
 
         #pragma endregion
@@ -0,0 +1,1100 @@
+#include "BadgerFleet.h"
+
+
+
+// STL headers.
+#include <algorithm>
+#include <cmath>
+#include <exception>
+#include <iostream>
+#include <string>
+
+
+
+// Engine headers.
+#include <Badger/SpeedKernel.h>
+#include <Badger/VehicleModel.h>
+#include <Framework/OgreApplication.h>
+#include <Misc/Profiler.h>
+#include <Misc/StateBuffer.h>
+#include <Misc/TransformBuffer.h>
+#include <Rendering/NullRenderer.h>
+#include <Utility/Maths.h>
+#include <Utility/Ogre.h>
+
+
+
+// Globals.
+const VehicleModel  model           {  };       //!< Every badger handles the same as a Badger, the arrays are stepped with the same rules.
+const float         defaultMaxSpeed { 80.f };   //!< The maximum speed a badger starts with.
+const float         gridSpacing     { 50.f };   //!< The distance between each badger when reset.
+const float         chassisScale    { 200.f };  //!< The models are tiny so every part is scaled up, the same as a Badger.
+
+const Ogre::Vector3 handleBarOffset     { 0.f, 0.0182f, 0.01f };    //!< The position of the handle bars relative to the chassis.
+const Ogre::Vector3 luggageRackOffset   { 0.f, 0.018f, -0.024f };   //!< The position of the luggage rack relative to the chassis.
+
+/// <summary> The same wheel layout as a Badger, front wheels come first and left wheels have even indices. </summary>
+const Ogre::Vector3 wheelOffsets[4]     =
+{
+    { 0.014f, -0.0025f, 0.0254f },
+    { -0.014f, -0.0025f, 0.0254f },
+    { 0.014f, -0.0038f, -0.0254f },
+    { -0.014f, -0.0038f, -0.0254f }
+};
+
+// The fixed orientations of each part, the wheels lie on their side.
+const Ogre::Quaternion  handleBarTilt       { Ogre::Degree (-37.784f), Ogre::Vector3::UNIT_X };
+const Ogre::Quaternion  leftOrientation     { Ogre::Degree (-90.f), Ogre::Vector3::UNIT_Z };
+const Ogre::Quaternion  rightOrientation    { Ogre::Degree (90.f), Ogre::Vector3::UNIT_Z };
+
+/// <summary> The index of each part in a flattened pose. Every part is a child of the chassis, which is the only node with a parent. </summary>
+enum Part : std::size_t
+{
+    PartChassis,
+    PartHandleBar,
+    PartLuggageRack,
+    PartFrontLeftWheel,
+    PartFrontRightWheel,
+    PartRearLeftWheel,
+    PartRearRightWheel,
+    PartCount
+};
+
+/// <summary> The position of each part relative to the chassis, before the chassis is scaled. </summary>
+const Ogre::Vector3 partOffsets[PartCount] =
+{
+    Ogre::Vector3::ZERO,
+    handleBarOffset,
+    luggageRackOffset,
+    wheelOffsets[0],
+    wheelOffsets[1],
+    wheelOffsets[2],
+    wheelOffsets[3]
+};
+
+
+
+// Helper functions.
+
+/// <summary> Blends between two angles the short way around. </summary>
+static float blendAngle (const float previous, const float current, const float alpha)
+{
+    return previous + util::wrapAngle (current - previous) * alpha;
+}
+
+
+/// <summary> Creates a rotation about the y axis without the overhead of the general angle-axis constructor. </summary>
+static Ogre::Quaternion yawRotation (const float angle)
+{
+    const float half { angle * 0.5f };
+    return { std::cos (half), 0.f, std::sin (half), 0.f };
+}
+
+
+/// <summary> Gathers a SceneNode, every node beneath it and every object attached to them, parents come before their children. </summary>
+static void collectNodes (Ogre::SceneNode* const node, std::vector<Ogre::SceneNode*>& nodes, std::vector<Ogre::MovableObject*>& objects)
+{
+    nodes.push_back (node);
+
+    auto attached = node->getAttachedObjectIterator();
+
+    while (attached.hasMoreElements())
+    {
+        objects.push_back (attached.getNext());
+    }
+
+    auto children = node->getChildIterator();
+
+    while (children.hasMoreElements())
+    {
+        collectNodes (static_cast<Ogre::SceneNode*> (children.getNext()), nodes, objects);
+    }
+}
+
+
+/// <summary> Calculates the orientation of each part relative to the chassis, indexed by Part. </summary>
+static void partOrientations (const float steering, const float spin, Ogre::Quaternion* const orientations)
+{
+    // Wheels revolve about their local axis, the front wheels are then steered about the chassis' axis. Right wheels revolve in reverse.
+    const auto  steer       = yawRotation (steering),
+                forwardSpin = yawRotation (spin),
+                reverseSpin = yawRotation (-spin);
+
+    orientations[PartChassis] = Ogre::Quaternion::IDENTITY;
+    orientations[PartHandleBar] = handleBarTilt * steer;
+    orientations[PartLuggageRack] = Ogre::Quaternion::IDENTITY;
+    orientations[PartFrontLeftWheel] = steer * leftOrientation * forwardSpin;
+    orientations[PartFrontRightWheel] = steer * rightOrientation * reverseSpin;
+    orientations[PartRearLeftWheel] = leftOrientation * forwardSpin;
+    orientations[PartRearRightWheel] = rightOrientation * reverseSpin;
+}
+
+
+
+#pragma region Constructors and destructor
+
+BadgerFleet::BadgerFleet()
+{
+}
+
+
+BadgerFleet::BadgerFleet (BadgerFleet&& move)
+{
+    *this = std::move (move);
+}
+
+
+BadgerFleet& BadgerFleet::operator= (BadgerFleet&& move)
+{
+    if (this != &move)
+    {
+        // Our own nodes and instances would otherwise be lost.
+        destroyNodes();
+        destroyInstances();
+
+        // BadgerFleet.
+        m_positionX = std::move (move.m_positionX);
+        m_positionY = std::move (move.m_positionY);
+        m_positionZ = std::move (move.m_positionZ);
+        m_heading = std::move (move.m_heading);
+        m_speed = std::move (move.m_speed);
+        m_maxSpeed = std::move (move.m_maxSpeed);
+        m_targetSpeedRate = std::move (move.m_targetSpeedRate);
+        m_steering = std::move (move.m_steering);
+        m_targetTurn = std::move (move.m_targetTurn);
+        m_wheelSpin = std::move (move.m_wheelSpin);
+
+        m_previousX = std::move (move.m_previousX);
+        m_previousZ = std::move (move.m_previousZ);
+        m_previousHeading = std::move (move.m_previousHeading);
+        m_previousSteering = std::move (move.m_previousSteering);
+        m_previousWheelSpin = std::move (move.m_previousWheelSpin);
+
+        m_avoidanceTurn = std::move (move.m_avoidanceTurn);
+        m_avoidanceSpeed = std::move (move.m_avoidanceSpeed);
+        m_avoidanceRadius = move.m_avoidanceRadius;
+        m_grid = std::move (move.m_grid);
+
+        m_chassisNodes = std::move (move.m_chassisNodes);
+        m_handleBarNodes = std::move (move.m_handleBarNodes);
+        m_wheelNodes = std::move (move.m_wheelNodes);
+        m_luggageRackNodes = std::move (move.m_luggageRackNodes);
+        m_flattened = move.m_flattened;
+        m_ogre = move.m_ogre;
+
+        m_chassisInstances = std::move (move.m_chassisInstances);
+        m_handleBarInstances = std::move (move.m_handleBarInstances);
+        m_luggageRackInstances = std::move (move.m_luggageRackInstances);
+        m_wheelInstances = std::move (move.m_wheelInstances);
+        m_instanceManagers = std::move (move.m_instanceManagers);
+        m_instanceScene = move.m_instanceScene;
+
+        // The moved fleet mustn't destroy what it no longer owns.
+        move.m_chassisNodes.clear();
+        move.m_handleBarNodes.clear();
+        move.m_wheelNodes.clear();
+        move.m_luggageRackNodes.clear();
+        move.m_ogre = nullptr;
+
+        move.m_chassisInstances.clear();
+        move.m_handleBarInstances.clear();
+        move.m_luggageRackInstances.clear();
+        move.m_wheelInstances.clear();
+        move.m_instanceManagers.clear();
+        move.m_instanceScene = nullptr;
+    }
+
+    return *this;
+}
+
+
+BadgerFleet::~BadgerFleet()
+{
+    destroyNodes();
+    destroyInstances();
+}
+
+#pragma endregion
+
+
+#pragma region Getters and setters
+
+const VehicleModel& BadgerFleet::getVehicleModel() const
+{
+    return model;
+}
+
+
+Ogre::Vector3 BadgerFleet::getPosition (const std::size_t badger) const
+{
+    return { m_positionX[badger], m_positionY[badger], m_positionZ[badger] };
+}
+
+
+void BadgerFleet::setPosition (const std::size_t badger, const Ogre::Vector3& position)
+{
+    m_positionX[badger] = m_previousX[badger] = position.x;
+    m_positionY[badger] = position.y;
+    m_positionZ[badger] = m_previousZ[badger] = position.z;
+}
+
+
+void BadgerFleet::setHeading (const std::size_t badger, const float heading)
+{
+    m_heading[badger] = m_previousHeading[badger] = util::wrapAngle (heading);
+}
+
+
+void BadgerFleet::setMaxSpeed (const std::size_t badger, const float speed)
+{
+    m_maxSpeed[badger] = speed;
+}
+
+
+void BadgerFleet::setSpeedRate (const std::size_t badger, const float speed)
+{
+    m_targetSpeedRate[badger] = util::clamp (speed, -1.f, 1.f);
+}
+
+
+void BadgerFleet::setTurnRate (const std::size_t badger, const float turn)
+{
+    m_targetTurn[badger] = util::clamp (turn, -1.f, 1.f);
+}
+
+
+void BadgerFleet::setAvoidanceRadius (const float radius)
+{
+    m_avoidanceRadius = util::max (radius, 0.f);
+
+    // A cell the size of the radius means each query visits at most nine cells.
+    m_grid.setCellSize (m_avoidanceRadius);
+
+    std::fill (m_avoidanceTurn.begin(), m_avoidanceTurn.end(), 0.f);
+}
+
+
+void BadgerFleet::reset()
+{
+    // Lay the badgers out in a square so they don't start inside each other.
+    const std::size_t count     { getCount() };
+    const std::size_t columns   { util::max (static_cast<std::size_t> (std::ceil (std::sqrt (static_cast<float> (count)))), static_cast<std::size_t> (1)) };
+
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        m_positionX[i] = (i % columns) * gridSpacing;
+        m_positionY[i] = 4.f;
+        m_positionZ[i] = (i / columns) * gridSpacing;
+    }
+
+    std::fill (m_heading.begin(), m_heading.end(), 0.f);
+    std::fill (m_speed.begin(), m_speed.end(), 0.f);
+    std::fill (m_maxSpeed.begin(), m_maxSpeed.end(), defaultMaxSpeed);
+    std::fill (m_targetSpeedRate.begin(), m_targetSpeedRate.end(), 0.f);
+    std::fill (m_steering.begin(), m_steering.end(), 0.f);
+    std::fill (m_targetTurn.begin(), m_targetTurn.end(), 0.f);
+    std::fill (m_wheelSpin.begin(), m_wheelSpin.end(), 0.f);
+    std::fill (m_avoidanceTurn.begin(), m_avoidanceTurn.end(), 0.f);
+
+    clearInterpolation();
+}
+
+#pragma endregion
+
+
+#pragma region Fleet functionality
+
+bool BadgerFleet::initialise (const std::size_t count, OgreApplication* const ogre, Ogre::SceneNode* const root, const Ogre::String& name, const bool flatten)
+{
+    try
+    {
+        // Pre-condition: Entities need somewhere to be attached.
+        if (ogre && !root)
+        {
+            throw std::invalid_argument ("BadgerFleet::initialise(), required parameter 'root' is a nullptr.");
+        }
+
+        resize (count);
+
+        if (root)
+        {
+            m_flattened = flatten;
+            m_ogre = ogre;
+
+            m_chassisNodes.reserve (count);
+            m_handleBarNodes.reserve (count);
+            m_wheelNodes.reserve (count * 4);
+
+            if (flatten)
+            {
+                m_luggageRackNodes.reserve (count);
+            }
+
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                createNodes (ogre, root, name + "-" + std::to_string (i), flatten);
+            }
+        }
+
+        reset();
+        interpolate (1.f);
+
+        return true;
+    }
+
+    catch (const std::exception& error)
+    {
+        std::cerr << "An exception was caught in BadgerFleet::initialise(): " << error.what() << std::endl;
+    }
+
+    catch (...)
+    {
+        std::cerr << "An unknown error occurred in BadgerFleet::initialise()." << std::endl;
+    }
+
+    return false;
+}
+
+
+bool BadgerFleet::initialiseInstanced (const std::size_t count, OgreApplication* const ogre, const Ogre::String& name)
+{
+    try
+    {
+        // Pre-condition: Instances need a SceneManager to be created by.
+        if (!ogre)
+        {
+            throw std::invalid_argument ("BadgerFleet::initialiseInstanced(), required parameter 'ogre' is a nullptr.");
+        }
+
+        // The null renderer has no hardware buffers to instance with, drawables still record the submissions of every part.
+        if (ogre->GetNullRenderer())
+        {
+            return initialise (count, ogre, ogre->GetSceneManager()->getRootSceneNode(), name);
+        }
+
+        resize (count);
+        createInstances (ogre->GetSceneManager(), name);
+
+        reset();
+        interpolate (1.f);
+
+        return true;
+    }
+
+    catch (const std::exception& error)
+    {
+        std::cerr << "An exception was caught in BadgerFleet::initialiseInstanced(): " << error.what() << std::endl;
+    }
+
+    catch (...)
+    {
+        std::cerr << "An unknown error occurred in BadgerFleet::initialiseInstanced()." << std::endl;
+    }
+
+    return false;
+}
+
+
+void BadgerFleet::updateSimulation (const float deltaTime)
+{
+    PROFILE_SCOPE ("BadgerFleet::updateSimulation");
+
+    prepareUpdate();
+    updateSimulation (0, getCount(), deltaTime);
+}
+
+
+void BadgerFleet::prepareUpdate()
+{
+    // The grid keeps its own copy of every position, so ranges can move their badgers whilst others are still avoiding them.
+    if (m_avoidanceRadius > 0.f)
+    {
+        updateSpatialHash();
+    }
+}
+
+
+void BadgerFleet::updateSimulation (const std::size_t begin, const std::size_t end, const float deltaTime)
+{
+    // Avoidance only adjusts the targets, so a badger still accelerates and turns at the usual rate.
+    if (m_avoidanceRadius > 0.f)
+    {
+        updateAvoidance (begin, end);
+    }
+
+    // The same order as a Badger: speed first, then movement using the steering from the previous step, then the steering itself.
+    updateSpeeds (begin, end, deltaTime);
+    updateMovement (begin, end, deltaTime);
+    updateSteering (begin, end, deltaTime);
+}
+
+#pragma endregion
+
+
+#pragma region Proximity
+
+void BadgerFleet::updateSpatialHash()
+{
+    PROFILE_SCOPE ("BadgerFleet::updateSpatialHash");
+
+    m_grid.build (m_positionX.data(), m_positionZ.data(), getCount());
+}
+
+
+std::size_t BadgerFleet::findNeighbours (const std::size_t badger, const float radius, std::vector<std::size_t>& neighbours) const
+{
+    const std::size_t before { neighbours.size() };
+
+    m_grid.forEachNeighbour (m_positionX[badger], m_positionZ[badger], radius, [&] (const std::size_t other, const float, const float)
+    {
+        if (other != badger)
+        {
+            neighbours.push_back (other);
+        }
+    });
+
+    return neighbours.size() - before;
+}
+
+
+std::size_t BadgerFleet::countOverlaps (const float distance) const
+{
+    std::size_t overlaps { 0 };
+
+    for (std::size_t i = 0; i < m_grid.getCount(); ++i)
+    {
+        // Only counting higher indices means each pair is counted once.
+        m_grid.forEachNeighbour (m_positionX[i], m_positionZ[i], distance, [&] (const std::size_t other, const float, const float)
+        {
+            if (other > i)
+            {
+                ++overlaps;
+            }
+        });
+    }
+
+    return overlaps;
+}
+
+#pragma endregion
+
+
+#pragma region Interpolation
+
+void BadgerFleet::beginStep()
+{
+    m_previousX = m_positionX;
+    m_previousZ = m_positionZ;
+    m_previousHeading = m_heading;
+    m_previousSteering = m_steering;
+    m_previousWheelSpin = m_wheelSpin;
+}
+
+
+void BadgerFleet::interpolate (const float alpha)
+{
+    PROFILE_SCOPE ("BadgerFleet::interpolate");
+
+    if (isInstanced())
+    {
+        writeInstances (alpha);
+    }
+
+    else if (isFlattened())
+    {
+        writeFlatNodes (alpha);
+    }
+
+    else if (hasNodes())
+    {
+        writeNodes (alpha);
+    }
+}
+
+
+void BadgerFleet::publish (TransformSnapshot& snapshot) const
+{
+    PROFILE_SCOPE ("BadgerFleet::publish");
+
+    if (!isInstanced() && !hasNodes())
+    {
+        return;
+    }
+
+    const std::size_t   count   { getCount() };
+    const Ogre::Vector3 scaled  { chassisScale, chassisScale, chassisScale };
+
+    Ogre::Vector3       previousPositions[PartCount],       positions[PartCount];
+    Ogre::Quaternion    previousOrientations[PartCount],    orientations[PartCount];
+
+    snapshot.transforms.reserve (snapshot.transforms.size() + count * PartCount);
+
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        // Parts of a hierarchical badger are relative to its chassis, otherwise every part has its own world transform.
+        if (isInstanced() || isFlattened())
+        {
+            flattenPose (i, 0.f, previousPositions, previousOrientations);
+            flattenPose (i, 1.f, positions, orientations);
+        }
+
+        else
+        {
+            partOrientations (m_previousSteering[i], m_previousWheelSpin[i], previousOrientations);
+            partOrientations (m_steering[i], m_wheelSpin[i], orientations);
+
+            std::copy (partOffsets, partOffsets + PartCount, previousPositions);
+            std::copy (partOffsets, partOffsets + PartCount, positions);
+
+            previousPositions[PartChassis] = { m_previousX[i], m_positionY[i], m_previousZ[i] };
+            positions[PartChassis] = { m_positionX[i], m_positionY[i], m_positionZ[i] };
+            previousOrientations[PartChassis] = yawRotation (m_previousHeading[i]);
+            orientations[PartChassis] = yawRotation (m_heading[i]);
+        }
+
+        const auto add = [&] (Ogre::SceneNode* const node, Ogre::InstancedEntity* const instance, const Part part)
+        {
+            ActorTransform transform {  };
+
+            transform.node = node;
+            transform.instance = instance;
+            transform.previousPosition = previousPositions[part];
+            transform.previousOrientation = previousOrientations[part];
+            transform.position = positions[part];
+            transform.orientation = orientations[part];
+            transform.scale = part == PartChassis || !node || isFlattened() ? scaled : Ogre::Vector3::UNIT_SCALE;
+
+            snapshot.transforms.push_back (transform);
+        };
+
+        const std::size_t wheel { i * 4 };
+
+        if (isInstanced())
+        {
+            add (nullptr, m_chassisInstances[i], PartChassis);
+            add (nullptr, m_handleBarInstances[i], PartHandleBar);
+            add (nullptr, m_luggageRackInstances[i], PartLuggageRack);
+
+            for (std::size_t j = 0; j < 4; ++j)
+            {
+                add (nullptr, m_wheelInstances[wheel + j], static_cast<Part> (PartFrontLeftWheel + j));
+            }
+        }
+
+        else
+        {
+            // The luggage rack only has to move when it isn't carried by the chassis.
+            add (m_chassisNodes[i], nullptr, PartChassis);
+            add (m_handleBarNodes[i], nullptr, PartHandleBar);
+
+            if (isFlattened())
+            {
+                add (m_luggageRackNodes[i], nullptr, PartLuggageRack);
+            }
+
+            for (std::size_t j = 0; j < 4; ++j)
+            {
+                add (m_wheelNodes[wheel + j], nullptr, static_cast<Part> (PartFrontLeftWheel + j));
+            }
+        }
+    }
+}
+
+#pragma endregion
+
+
+#pragma region State
+
+void BadgerFleet::saveState (StateBuffer& buffer) const
+{
+    buffer.write (m_positionX);
+    buffer.write (m_positionY);
+    buffer.write (m_positionZ);
+    buffer.write (m_heading);
+    buffer.write (m_speed);
+    buffer.write (m_maxSpeed);
+    buffer.write (m_targetSpeedRate);
+    buffer.write (m_steering);
+    buffer.write (m_targetTurn);
+    buffer.write (m_wheelSpin);
+
+    buffer.write (m_previousX);
+    buffer.write (m_previousZ);
+    buffer.write (m_previousHeading);
+    buffer.write (m_previousSteering);
+    buffer.write (m_previousWheelSpin);
+}
+
+
+void BadgerFleet::restoreState (StateBuffer& buffer)
+{
+    buffer.read (m_positionX);
+    buffer.read (m_positionY);
+    buffer.read (m_positionZ);
+    buffer.read (m_heading);
+    buffer.read (m_speed);
+    buffer.read (m_maxSpeed);
+    buffer.read (m_targetSpeedRate);
+    buffer.read (m_steering);
+    buffer.read (m_targetTurn);
+    buffer.read (m_wheelSpin);
+
+    buffer.read (m_previousX);
+    buffer.read (m_previousZ);
+    buffer.read (m_previousHeading);
+    buffer.read (m_previousSteering);
+    buffer.read (m_previousWheelSpin);
+}
+
+#pragma endregion
+
+
+#pragma region Simulation
+
+void BadgerFleet::updateAvoidance (const std::size_t begin, const std::size_t end)
+{
+    PROFILE_SCOPE ("BadgerFleet::updateAvoidance");
+
+    const float radius { m_avoidanceRadius };
+
+    for (std::size_t i = begin; i < end; ++i)
+    {
+        // A positive turn rate decreases the heading, which turns away from neighbours on the side an increasing heading turns towards.
+        const float forwardX    { std::sin (m_heading[i]) },
+                    forwardZ    { std::cos (m_heading[i]) };
+
+        float       turn        { 0.f },
+                    slowdown    { 1.f };
+
+        m_grid.forEachNeighbour (m_positionX[i], m_positionZ[i], radius, [&] (const std::size_t other, const float offsetX, const float offsetZ)
+        {
+            const float distance { std::sqrt (offsetX * offsetX + offsetZ * offsetZ) };
+
+            if (other == i || distance == 0.f)
+            {
+                return;
+            }
+
+            // Closer neighbours push harder, neighbours directly ahead or behind don't turn the badger at all.
+            const float side    { (offsetX * forwardZ - offsetZ * forwardX) / distance },
+                        ahead   { offsetX * forwardX + offsetZ * forwardZ };
+
+            turn += side * (1.f - distance / radius);
+
+            if (ahead > 0.f)
+            {
+                slowdown = util::min (slowdown, distance / radius);
+            }
+        });
+
+        m_avoidanceTurn[i] = turn;
+        m_avoidanceSpeed[i] = m_targetSpeedRate[i] * slowdown;
+    }
+}
+
+
+void BadgerFleet::updateSpeeds (const std::size_t begin, const std::size_t end, const float deltaTime)
+{
+    kernel::SpeedInput input {  };
+    input.speeds = m_speed.data() + begin;
+    input.maxSpeeds = m_maxSpeed.data() + begin;
+    input.targets = (m_avoidanceRadius > 0.f ? m_avoidanceSpeed.data() : m_targetSpeedRate.data()) + begin;
+    input.count = end - begin;
+    input.acceleration = model.getAcceleration();
+    input.brakePower = model.getBrakePower();
+
+    kernel::integrateSpeeds (input, deltaTime);
+}
+
+
+void BadgerFleet::updateMovement (const std::size_t begin, const std::size_t end, const float deltaTime)
+{
+    // The same rules as a single Badger, just applied to every array.
+    for (std::size_t i = begin; i < end; ++i)
+    {
+        const float distance    { m_speed[i] * deltaTime },
+                    heading     { m_heading[i] },
+                    steering    { m_steering[i] };
+
+        m_positionX[i] += std::sin (heading) * distance;
+        m_positionZ[i] += std::cos (heading) * distance;
+
+        m_heading[i] = util::wrapAngle (heading + model.turnFor (distance, steering));
+        m_wheelSpin[i] = util::wrapAngle (m_wheelSpin[i] + model.spinFor (distance));
+    }
+}
+
+
+void BadgerFleet::updateSteering (const std::size_t begin, const std::size_t end, const float deltaTime)
+{
+    for (std::size_t i = begin; i < end; ++i)
+    {
+        // Avoidance adds to the requested turn.
+        m_steering[i] = model.steerTowards (m_steering[i], util::clamp (m_targetTurn[i] + m_avoidanceTurn[i], -1.f, 1.f), deltaTime);
+    }
+}
+
+#pragma endregion
+
+
+#pragma region Rendering
+
+BadgerFleet::Pose BadgerFleet::blend (const std::size_t badger, const float alpha) const
+{
+    return
+    {
+        m_previousX[badger] + (m_positionX[badger] - m_previousX[badger]) * alpha,
+        m_previousZ[badger] + (m_positionZ[badger] - m_previousZ[badger]) * alpha,
+        blendAngle (m_previousHeading[badger], m_heading[badger], alpha),
+        blendAngle (m_previousSteering[badger], m_steering[badger], alpha),
+        blendAngle (m_previousWheelSpin[badger], m_wheelSpin[badger], alpha)
+    };
+}
+
+
+void BadgerFleet::flattenPose (const std::size_t badger, const float alpha, Ogre::Vector3* const positions, Ogre::Quaternion* const orientations) const
+{
+    const auto pose = blend (badger, alpha);
+
+    const Ogre::Vector3     position    { pose.x, m_positionY[badger], pose.z };
+    const Ogre::Quaternion  chassis     { yawRotation (pose.heading) };
+
+    partOrientations (pose.steering, pose.spin, orientations);
+
+    // Each part is offset in the scaled space of the chassis, the same as the scene graph would combine them.
+    for (std::size_t part = 0; part < PartCount; ++part)
+    {
+        positions[part] = position + chassis * (partOffsets[part] * chassisScale);
+        orientations[part] = chassis * orientations[part];
+    }
+}
+
+
+void BadgerFleet::writeNodes (const float alpha)
+{
+    const std::size_t count { getCount() };
+
+    Ogre::Quaternion orientations[PartCount];
+
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        const auto pose = blend (i, alpha);
+
+        m_chassisNodes[i]->setPosition (pose.x, m_positionY[i], pose.z);
+        m_chassisNodes[i]->setOrientation (yawRotation (pose.heading));
+
+        // Every other part is relative to the chassis so the scene graph does the rest.
+        partOrientations (pose.steering, pose.spin, orientations);
+
+        m_handleBarNodes[i]->setOrientation (orientations[PartHandleBar]);
+
+        const std::size_t wheel { i * 4 };
+
+        m_wheelNodes[wheel]->setOrientation (orientations[PartFrontLeftWheel]);
+        m_wheelNodes[wheel + 1]->setOrientation (orientations[PartFrontRightWheel]);
+        m_wheelNodes[wheel + 2]->setOrientation (orientations[PartRearLeftWheel]);
+        m_wheelNodes[wheel + 3]->setOrientation (orientations[PartRearRightWheel]);
+    }
+}
+
+
+void BadgerFleet::writeInstances (const float alpha)
+{
+    const std::size_t count { getCount() };
+
+    Ogre::Vector3       positions[PartCount];
+    Ogre::Quaternion    orientations[PartCount];
+
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        flattenPose (i, alpha, positions, orientations);
+
+        // The position is set without updating so the transform is only rebuilt once.
+        const auto place = [&] (Ogre::InstancedEntity* const instance, const Part part)
+        {
+            instance->setPosition (positions[part], false);
+            instance->setOrientation (orientations[part]);
+        };
+
+        place (m_chassisInstances[i], PartChassis);
+        place (m_handleBarInstances[i], PartHandleBar);
+        place (m_luggageRackInstances[i], PartLuggageRack);
+
+        const std::size_t wheel { i * 4 };
+
+        place (m_wheelInstances[wheel], PartFrontLeftWheel);
+        place (m_wheelInstances[wheel + 1], PartFrontRightWheel);
+        place (m_wheelInstances[wheel + 2], PartRearLeftWheel);
+        place (m_wheelInstances[wheel + 3], PartRearRightWheel);
+    }
+}
+
+
+void BadgerFleet::writeFlatNodes (const float alpha)
+{
+    const std::size_t count { getCount() };
+
+    Ogre::Vector3       positions[PartCount];
+    Ogre::Quaternion    orientations[PartCount];
+
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        flattenPose (i, alpha, positions, orientations);
+
+        // The root has no transform so these are the derived transforms too, no part waits on its chassis being updated.
+        const auto place = [&] (Ogre::SceneNode* const node, const Part part)
+        {
+            node->setPosition (positions[part]);
+            node->setOrientation (orientations[part]);
+        };
+
+        place (m_chassisNodes[i], PartChassis);
+        place (m_handleBarNodes[i], PartHandleBar);
+        place (m_luggageRackNodes[i], PartLuggageRack);
+
+        const std::size_t wheel { i * 4 };
+
+        place (m_wheelNodes[wheel], PartFrontLeftWheel);
+        place (m_wheelNodes[wheel + 1], PartFrontRightWheel);
+        place (m_wheelNodes[wheel + 2], PartRearLeftWheel);
+        place (m_wheelNodes[wheel + 3], PartRearRightWheel);
+    }
+}
+
+#pragma endregion
+
+
+#pragma region Helper functions
+
+void BadgerFleet::createNodes (OgreApplication* const ogre, Ogre::SceneNode* const root, const Ogre::String& name, const bool flatten)
+{
+    // Flattened parts have no parent to inherit the scale of the chassis from, so each is given the scale itself.
+    const auto chassis      = root->createChildSceneNode (name);
+    const auto parent       = flatten ? root : chassis;
+    const auto handleBar    = parent->createChildSceneNode (name + "-HandleBar");
+    const auto luggageRack  = parent->createChildSceneNode (name + "-LuggageRack");
+
+    chassis->setScale (chassisScale, chassisScale, chassisScale);
+
+    if (flatten)
+    {
+        handleBar->setScale (chassisScale, chassisScale, chassisScale);
+        luggageRack->setScale (chassisScale, chassisScale, chassisScale);
+        m_luggageRackNodes.push_back (luggageRack);
+    }
+
+    else
+    {
+        handleBar->setPosition (handleBarOffset);
+        luggageRack->setPosition (luggageRackOffset);
+    }
+
+    for (unsigned int i = 0; i < 4; ++i)
+    {
+        const auto wheel = parent->createChildSceneNode (name + "-Wheel-" + std::to_string (i));
+
+        if (flatten)
+        {
+            wheel->setScale (chassisScale, chassisScale, chassisScale);
+        }
+
+        else
+        {
+            wheel->setPosition (wheelOffsets[i]);
+        }
+
+        if (const auto entity = util::createEntity (ogre, "Wheel.mesh", "blue"))
+        {
+            wheel->attachObject (entity);
+        }
+
+        m_wheelNodes.push_back (wheel);
+    }
+
+    if (const auto entity = util::createEntity (ogre, "chassis.mesh", "green"))
+    {
+        chassis->attachObject (entity);
+    }
+
+    if (const auto entity = util::createEntity (ogre, "handlebar.mesh", "blue"))
+    {
+        handleBar->attachObject (entity);
+    }
+
+    if (const auto entity = util::createEntity (ogre, "luggage_rack.mesh", "green"))
+    {
+        luggageRack->attachObject (entity);
+    }
+
+    m_chassisNodes.push_back (chassis);
+    m_handleBarNodes.push_back (handleBar);
+}
+
+
+void BadgerFleet::resize (const std::size_t count)
+{
+    m_positionX.assign (count, 0.f);
+    m_positionY.assign (count, 0.f);
+    m_positionZ.assign (count, 0.f);
+    m_heading.assign (count, 0.f);
+    m_speed.assign (count, 0.f);
+    m_maxSpeed.assign (count, defaultMaxSpeed);
+    m_targetSpeedRate.assign (count, 0.f);
+    m_steering.assign (count, 0.f);
+    m_targetTurn.assign (count, 0.f);
+    m_wheelSpin.assign (count, 0.f);
+
+    m_previousX.assign (count, 0.f);
+    m_previousZ.assign (count, 0.f);
+    m_previousHeading.assign (count, 0.f);
+    m_previousSteering.assign (count, 0.f);
+    m_previousWheelSpin.assign (count, 0.f);
+
+    m_avoidanceTurn.assign (count, 0.f);
+    m_avoidanceSpeed.assign (count, 0.f);
+    m_grid.build (m_positionX.data(), m_positionZ.data(), count);
+
+    destroyNodes();
+    destroyInstances();
+}
+
+
+
+void BadgerFleet::createInstances (Ogre::SceneManager* const sceneManager, const Ogre::String& name)
+{
+    const std::size_t count { getCount() };
+
+    m_instanceScene = sceneManager;
+
+    // Each batch is big enough for every instance of its part so there is one draw call per part, however many badgers there are.
+    const auto createManager = [&] (const Ogre::String& part, const Ogre::String& mesh, const std::size_t instances)
+    {
+        const auto managerName  = name + "-" + part;
+        const auto manager      = sceneManager->createInstanceManager (managerName, mesh, Ogre::ResourceGroupManager::AUTODETECT_RESOURCE_GROUP_NAME,
+                                                                       Ogre::InstanceManager::HWInstancingBasic, util::max (instances, static_cast<std::size_t> (1)));
+        manager->setSetting (Ogre::InstanceManager::CAST_SHADOWS, false);
+        m_instanceManagers.push_back (managerName);
+
+        return managerName;
+    };
+
+    const auto  chassis         = createManager ("Chassis", "chassis.mesh", count),
+                handleBar       = createManager ("HandleBar", "handlebar.mesh", count),
+                luggageRack     = createManager ("LuggageRack", "luggage_rack.mesh", count),
+                wheel           = createManager ("Wheel", "Wheel.mesh", count * 4);
+
+    util::createInstancedMaterial ("blue/Instanced", "blue.png");
+    util::createInstancedMaterial ("green/Instanced", "green.png");
+
+    // Instances have no parent so the scale of the chassis is given to every part.
+    const auto createInstance = [&] (const Ogre::String& material, const Ogre::String& manager)
+    {
+        const auto instance = sceneManager->createInstancedEntity (material, manager);
+        instance->setScale ({ chassisScale, chassisScale, chassisScale }, false);
+
+        return instance;
+    };
+
+    m_chassisInstances.reserve (count);
+    m_handleBarInstances.reserve (count);
+    m_luggageRackInstances.reserve (count);
+    m_wheelInstances.reserve (count * 4);
+
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        m_chassisInstances.push_back (createInstance ("green/Instanced", chassis));
+        m_handleBarInstances.push_back (createInstance ("blue/Instanced", handleBar));
+        m_luggageRackInstances.push_back (createInstance ("green/Instanced", luggageRack));
+
+        for (unsigned int j = 0; j < 4; ++j)
+        {
+            m_wheelInstances.push_back (createInstance ("blue/Instanced", wheel));
+        }
+    }
+}
+
+
+void BadgerFleet::destroyNodes()
+{
+    if (!m_chassisNodes.empty())
+    {
+        // Flattened parts are attached to the root, otherwise they're beneath their chassis. The luggage rack is only tracked when flattened.
+        std::vector<Ogre::SceneNode*>       nodes   {  };
+        std::vector<Ogre::MovableObject*>   objects {  };
+
+        for (const auto tracked : { &m_chassisNodes, &m_handleBarNodes, &m_luggageRackNodes, &m_wheelNodes })
+        {
+            if (tracked == &m_chassisNodes || m_flattened)
+            {
+                for (const auto node : *tracked)
+                {
+                    collectNodes (node, nodes, objects);
+                }
+            }
+        }
+
+        const auto sceneManager = m_chassisNodes.front()->getCreator();
+
+        for (const auto node : nodes)
+        {
+            node->detachAllObjects();
+        }
+
+        // Drawables belong to the null renderer, everything else was created by the SceneManager.
+        if (const auto nullRenderer = m_ogre ? m_ogre->GetNullRenderer() : nullptr)
+        {
+            nullRenderer->destroyDrawables (objects);
+        }
+
+        else
+        {
+            for (const auto object : objects)
+            {
+                sceneManager->destroyMovableObject (object);
+            }
+        }
+
+        // Children are destroyed before their parents so none are left orphaned.
+        for (auto node = nodes.rbegin(); node != nodes.rend(); ++node)
+        {
+            sceneManager->destroySceneNode (*node);
+        }
+    }
+
+    m_chassisNodes.clear();
+    m_handleBarNodes.clear();
+    m_wheelNodes.clear();
+    m_luggageRackNodes.clear();
+    m_flattened = false;
+    m_ogre = nullptr;
+}
+
+
+void BadgerFleet::destroyInstances()
+{
+    if (m_instanceScene)
+    {
+        for (const auto instances : { &m_chassisInstances, &m_handleBarInstances, &m_luggageRackInstances, &m_wheelInstances })
+        {
+            for (const auto instance : *instances)
+            {
+                m_instanceScene->destroyInstancedEntity (instance);
+            }
+        }
+
+        // The names are reused when the fleet is instanced again so the managers must go too.
+        for (const auto& manager : m_instanceManagers)
+        {
+            m_instanceScene->destroyInstanceManager (manager);
+        }
+    }
+
+    m_chassisInstances.clear();
+    m_handleBarInstances.clear();
+    m_luggageRackInstances.clear();
+    m_wheelInstances.clear();
+    m_instanceManagers.clear();
+    m_instanceScene = nullptr;
+}
+
+#pragma endregion
\ No newline at end of file
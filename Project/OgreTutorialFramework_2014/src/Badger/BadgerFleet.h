@@ -0,0 +1,296 @@
+#pragma once
+
+#ifndef _BADGER_FLEET_
+#define _BADGER_FLEET_
+
+
+// STL headers.
+#include <vector>
+
+
+// Engine headers.
+#include <Misc/SpatialHash.h>
+
+
+// Forward declarations.
+class OgreApplication;
+class StateBuffer;
+class VehicleModel;
+struct TransformSnapshot;
+
+
+/// <summary>
+/// Simulates many badgers at once. Rather than six actors per vehicle, each part of the state is kept in its own contiguous array which is
+/// updated in a tight loop, and every SceneNode is written in a single pass afterwards. Badgers only turn about the vertical axis so the
+/// heading, steering and wheel spin are stored as plain angles. The fleet can run without any nodes at all for batch simulations, or be
+/// drawn with hardware instancing where each part is a single instance batch so the draw calls don't grow with the fleet. The part hierarchy
+/// never changes, so it can also be flattened: every part becomes a direct child of the root and its world transform is written directly.
+/// </summary>
+class BadgerFleet final
+{
+    public:
+
+        #pragma region Constructors and destructor
+
+        BadgerFleet();
+
+        BadgerFleet (BadgerFleet&& move);
+        BadgerFleet& operator= (BadgerFleet&& move);
+
+        ~BadgerFleet();
+
+        BadgerFleet (const BadgerFleet& copy)               = delete;
+        BadgerFleet& operator= (const BadgerFleet& copy)    = delete;
+
+        #pragma endregion
+
+        #pragma region Getters and setters
+
+        /// <summary> Gets the number of badgers in the fleet. </summary>
+        std::size_t getCount() const                        { return m_speed.size(); }
+
+        /// <summary> Gets whether the fleet writes to SceneNodes. </summary>
+        bool hasNodes() const                               { return !m_chassisNodes.empty(); }
+
+        /// <summary> Gets whether every part node is a direct child of the root rather than of its chassis node. </summary>
+        bool isFlattened() const                            { return m_flattened; }
+
+        /// <summary> Gets whether the fleet writes to instanced entities. </summary>
+        bool isInstanced() const                            { return !m_chassisInstances.empty(); }
+
+        float getSpeed (const std::size_t badger) const     { return m_speed[badger]; }
+        float getMaxSpeed (const std::size_t badger) const  { return m_maxSpeed[badger]; }
+        float getHeading (const std::size_t badger) const   { return m_heading[badger]; }
+        float getSteering (const std::size_t badger) const  { return m_steering[badger]; }
+
+        /// <summary> Gets the motion model every badger is stepped with. </summary>
+        const VehicleModel& getVehicleModel() const;
+
+        /// <summary> Gets the distance at which badgers start avoiding each other, zero when avoidance is disabled. </summary>
+        float getAvoidanceRadius() const                    { return m_avoidanceRadius; }
+
+        /// <summary> Gets the grid of badger positions, this is only current after updateSpatialHash() or a step with avoidance enabled. </summary>
+        const SpatialHash& getSpatialHash() const           { return m_grid; }
+
+        /// <summary> Gets the simulated position of a badger. </summary>
+        Ogre::Vector3 getPosition (const std::size_t badger) const;
+
+        /// <summary> Moves a badger, this discards its interpolation so it doesn't appear to slide into place. </summary>
+        void setPosition (const std::size_t badger, const Ogre::Vector3& position);
+
+        /// <summary> Turns a badger to face a heading, this discards its interpolation the same as setPosition(). </summary>
+        void setHeading (const std::size_t badger, const float heading);
+
+        /// <summary> Sets the maximum speed a badger can reach. </summary>
+        void setMaxSpeed (const std::size_t badger, const float speed);
+
+        /// <summary> Sets the target speed rate of the maximum speed, this will be achieved over time. </summary>
+        /// <param name="speed"> This will be clamped between -1.f and 1.f. </param>
+        void setSpeedRate (const std::size_t badger, const float speed);
+
+        /// <summary> Sets how much the wheels and handle bars of a badger should be turned. </summary>
+        /// <param name="turn"> This will be clamped between -1.f and 1.f. </param>
+        void setTurnRate (const std::size_t badger, const float turn);
+
+        /// <summary> Sets the distance at which badgers steer away from and slow down behind each other, this also sizes the grid cells. </summary>
+        /// <param name="radius"> Zero or less disables avoidance so badgers only follow their target speed and turn. </param>
+        void setAvoidanceRadius (const float radius);
+
+        /// <summary> Places every badger on a grid, stationary and facing forward. </summary>
+        void reset();
+
+        #pragma endregion
+
+        #pragma region Fleet functionality
+
+        /// <summary> Creates the fleet. Passing a root without an OgreApplication creates nodes without entities, passing neither creates no nodes. </summary>
+        /// <param name="count"> The number of badgers to create. </param>
+        /// <param name="ogre"> The OgreApplication used for creating entities. </param>
+        /// <param name="root"> The SceneNode to attach each badger to. </param>
+        /// <param name="name"> The prefix used to give each SceneNode a unique name. </param>
+        /// <param name="flatten"> Attaches every part to the root and writes world transforms, so Ogre never propagates a chassis to its parts. </param>
+        /// <returns> Whether the initialisation was successful. </returns>
+        bool initialise (const std::size_t count, OgreApplication* const ogre = nullptr, Ogre::SceneNode* const root = nullptr, const Ogre::String& name = "BadgerFleet",
+                         const bool flatten = false);
+
+        /// <summary>
+        /// Creates the fleet using one InstanceManager per part, the transform of every instance is written directly without SceneNodes.
+        /// The null render backend can't instance so it falls back to initialise() with the root SceneNode.
+        /// </summary>
+        /// <param name="count"> The number of badgers to create. </param>
+        /// <param name="ogre"> The OgreApplication whose SceneManager creates the instances. </param>
+        /// <param name="name"> The prefix used to give each InstanceManager a unique name. </param>
+        /// <returns> Whether the initialisation was successful. </returns>
+        bool initialiseInstanced (const std::size_t count, OgreApplication* const ogre, const Ogre::String& name = "BadgerFleet");
+
+        /// <summary> Updates the speed, position, heading, wheel spin and steering of every badger. </summary>
+        /// <param name="deltaTime"> The number of seconds passed since the last update. </param>
+        void updateSimulation (const float deltaTime);
+
+        /// <summary> Rebuilds the grid when avoidance is enabled, this must be called once per step before any range is updated. </summary>
+        void prepareUpdate();
+
+        /// <summary>
+        /// Updates a range of badgers the same as updateSimulation(). Each badger only writes its own state and avoids the positions captured
+        /// by prepareUpdate(), so separate ranges can be updated concurrently and the result doesn't depend on how the fleet was split.
+        /// </summary>
+        /// <param name="begin"> The first badger to update. </param>
+        /// <param name="end"> One past the last badger to update. </param>
+        /// <param name="deltaTime"> The number of seconds passed since the last update. </param>
+        void updateSimulation (const std::size_t begin, const std::size_t end, const float deltaTime);
+
+        #pragma endregion
+
+        #pragma region Proximity
+
+        /// <summary> Rebuilds the grid from the current position of every badger. </summary>
+        void updateSpatialHash();
+
+        /// <summary> Finds every other badger within a radius of a badger using the grid. </summary>
+        /// <param name="neighbours"> The index of each badger found is appended to this. </param>
+        /// <returns> How many badgers were found. </returns>
+        std::size_t findNeighbours (const std::size_t badger, const float radius, std::vector<std::size_t>& neighbours) const;
+
+        /// <summary> Counts the pairs of badgers closer than the given distance using the grid, each pair is counted once. </summary>
+        std::size_t countOverlaps (const float distance) const;
+
+        #pragma endregion
+
+        #pragma region Interpolation
+
+        /// <summary> Remembers the current state as the previous state, this should be called before each fixed simulation step. </summary>
+        void beginStep();
+
+        /// <summary> Writes a blend of the previous and current state of every badger to the SceneNodes or instances in a single pass. </summary>
+        /// <param name="alpha"> How far between the previous (0.f) and current (1.f) step to render the fleet. </param>
+        void interpolate (const float alpha);
+
+        /// <summary> Appends the previous and current transform of every part so the fleet can be stepped on another thread to rendering. </summary>
+        /// <param name="snapshot"> The snapshot being written by the simulation. </param>
+        void publish (TransformSnapshot& snapshot) const;
+
+        /// <summary> Discards the previous state so the fleet is displayed exactly where it is. </summary>
+        void clearInterpolation()                           { beginStep(); }
+
+        #pragma endregion
+
+        #pragma region State
+
+        /// <summary> Appends the state of every badger, each array is written as a single block. </summary>
+        /// <param name="buffer"> The buffer to append to. </param>
+        void saveState (StateBuffer& buffer) const;
+
+        /// <summary> Restores the state written by saveState(), the fleet must have the same number of badgers. </summary>
+        /// <param name="buffer"> The buffer to read from. </param>
+        void restoreState (StateBuffer& buffer);
+
+        #pragma endregion
+
+    private:
+
+        #pragma region Simulation
+
+        /// <summary> Steers each badger away from its neighbours and slows it down when a neighbour is ahead. </summary>
+        void updateAvoidance (const std::size_t begin, const std::size_t end);
+
+        /// <summary> Accelerates or brakes each badger towards its target speed. </summary>
+        void updateSpeeds (const std::size_t begin, const std::size_t end, const float deltaTime);
+
+        /// <summary> Moves each badger forward, turning it according to its steering and revolving its wheels. </summary>
+        void updateMovement (const std::size_t begin, const std::size_t end, const float deltaTime);
+
+        /// <summary> Turns the handle bars and front wheels of each badger towards their target. </summary>
+        void updateSteering (const std::size_t begin, const std::size_t end, const float deltaTime);
+
+        #pragma endregion
+
+        #pragma region Rendering
+
+        /// <summary> The transform of a badger blended between the previous and current step. </summary>
+        struct Pose final
+        {
+            float x, z, heading, steering, spin;
+        };
+
+        /// <summary> Blends the previous and current state of a badger. </summary>
+        Pose blend (const std::size_t badger, const float alpha) const;
+
+        /// <summary> Calculates the world transform of every part of a badger in one pass over the fixed hierarchy. </summary>
+        /// <param name="positions"> Receives the position of each part, indexed by the Part enumeration in the source file. </param>
+        /// <param name="orientations"> Receives the orientation of each part. </param>
+        void flattenPose (const std::size_t badger, const float alpha, Ogre::Vector3* const positions, Ogre::Quaternion* const orientations) const;
+
+        /// <summary> Writes every pose to the SceneNodes, the scene graph combines each part with its chassis. </summary>
+        void writeNodes (const float alpha);
+
+        /// <summary> Writes the world transform of every part to nodes which are direct children of the root. </summary>
+        void writeFlatNodes (const float alpha);
+
+        /// <summary> Writes every pose to the instances, each part is combined with its chassis here because instances have no parent. </summary>
+        void writeInstances (const float alpha);
+
+        #pragma endregion
+
+        #pragma region Helper functions
+
+        /// <summary> Creates the nodes and entities of a single badger. </summary>
+        /// <param name="flatten"> Whether each part is attached to the root instead of the chassis. </param>
+        void createNodes (OgreApplication* const ogre, Ogre::SceneNode* const root, const Ogre::String& name, const bool flatten);
+
+        /// <summary> Creates an InstanceManager for each part and an instance of each part for every badger. </summary>
+        void createInstances (Ogre::SceneManager* const sceneManager, const Ogre::String& name);
+
+        /// <summary> Destroys every node created by the fleet along with the entities attached to them, so the names can be used again. </summary>
+        void destroyNodes();
+
+        /// <summary> Destroys every instance and the InstanceManager of each part, so the fleet can be instanced again under the same name. </summary>
+        void destroyInstances();
+
+        /// <summary> Resizes every array to the given count. </summary>
+        void resize (const std::size_t count);
+
+        #pragma endregion
+
+        #pragma region Implementation data
+
+        std::vector<float>              m_positionX         {  };   //!< The simulated position of each badger on the x axis.
+        std::vector<float>              m_positionY         {  };   //!< The simulated position of each badger on the y axis, badgers never leave the ground.
+        std::vector<float>              m_positionZ         {  };   //!< The simulated position of each badger on the z axis.
+        std::vector<float>              m_heading           {  };   //!< The rotation of each badger about the y axis in radians.
+        std::vector<float>              m_speed             {  };   //!< The current speed of each badger.
+        std::vector<float>              m_maxSpeed          {  };   //!< The maximum speed of each badger.
+        std::vector<float>              m_targetSpeedRate   {  };   //!< A normalised value between -1.f and 1.f representing the desired speed.
+        std::vector<float>              m_steering          {  };   //!< The yaw of the handle bars and front wheels in radians.
+        std::vector<float>              m_targetTurn        {  };   //!< A normalised target turn between -1.f and 1.f.
+        std::vector<float>              m_wheelSpin         {  };   //!< How far the wheels have revolved in radians, shared by every wheel.
+
+        std::vector<float>              m_previousX         {  };   //!< The x position of each badger before the most recent step.
+        std::vector<float>              m_previousZ         {  };   //!< The z position of each badger before the most recent step.
+        std::vector<float>              m_previousHeading   {  };   //!< The heading of each badger before the most recent step.
+        std::vector<float>              m_previousSteering  {  };   //!< The steering of each badger before the most recent step.
+        std::vector<float>              m_previousWheelSpin {  };   //!< The wheel spin of each badger before the most recent step.
+
+        std::vector<float>              m_avoidanceTurn     {  };   //!< Added to the target turn of each badger to steer away from its neighbours.
+        std::vector<float>              m_avoidanceSpeed    {  };   //!< The target speed rate of each badger after slowing down for its neighbours.
+        float                           m_avoidanceRadius   { 0.f }; //!< The distance at which badgers start avoiding each other.
+        SpatialHash                     m_grid              {  };   //!< The position of every badger as of the most recent rebuild.
+
+        std::vector<Ogre::SceneNode*>   m_chassisNodes      {  };   //!< The node of each badger, empty when the fleet has no nodes.
+        std::vector<Ogre::SceneNode*>   m_handleBarNodes    {  };   //!< The handle bar node of each badger.
+        std::vector<Ogre::SceneNode*>   m_wheelNodes        {  };   //!< Four wheel nodes per badger, front wheels come first.
+        std::vector<Ogre::SceneNode*>   m_luggageRackNodes  {  };   //!< The luggage rack node of each badger, empty unless the hierarchy is flattened.
+        bool                            m_flattened         { false }; //!< Whether every part node was attached to the root instead of its chassis.
+        OgreApplication*                m_ogre              { nullptr }; //!< The application which created the entities attached to the nodes, if any.
+
+        std::vector<Ogre::InstancedEntity*> m_chassisInstances      {  };   //!< The chassis of each badger, empty unless the fleet is instanced.
+        std::vector<Ogre::InstancedEntity*> m_handleBarInstances    {  };   //!< The handle bars of each badger.
+        std::vector<Ogre::InstancedEntity*> m_luggageRackInstances  {  };   //!< The luggage rack of each badger, these move with the chassis.
+        std::vector<Ogre::InstancedEntity*> m_wheelInstances        {  };   //!< Four wheels per badger, front wheels come first.
+        std::vector<Ogre::String>           m_instanceManagers      {  };   //!< The name of the InstanceManager of each part.
+        Ogre::SceneManager*                 m_instanceScene         { nullptr }; //!< The SceneManager which owns the instances and their managers.
+
+        #pragma endregion
+
+};
+
+#endif // _BADGER_FLEET_
\ No newline at end of file
@@ -23,10 +23,15 @@ Badger::HandleBar& Badger::HandleBar::operator= (HandleBar&& move)
     {
         // IActor.
         m_node = std::move (move.m_node);
+        m_position = std::move (move.m_position);
+        m_orientation = std::move (move.m_orientation);
+        m_scale = std::move (move.m_scale);
+        m_previousPosition = std::move (move.m_previousPosition);
+        m_previousOrientation = std::move (move.m_previousOrientation);
 
         // Badger::IRotatableComponent.
-        m_turnSpeed = std::move (move.m_turnSpeed);
-        m_targetTurn = std::move (move.m_targetTurn);
+        m_baseOrientation = std::move (move.m_baseOrientation);
+        m_steering = std::move (move.m_steering);
     }
 
     return *this;
@@ -45,12 +50,13 @@ Badger::HandleBar::~HandleBar()
 void Badger::HandleBar::reset()
 {
     // Reset the node itself.
-    m_node->setPosition ({ 0.f, 0.0182f, 0.01f });
-    m_node->setOrientation ({ Ogre::Degree (-37.784f), Ogre::Vector3::UNIT_X });
-    m_node->setScale ({ 1.f, 1.f, 1.f });
+    setPosition ({ 0.f, 0.0182f, 0.01f });
+    setScale ({ 1.f, 1.f, 1.f });
 
-    // Ensure the handle bars won't turn without more input.
-    m_targetTurn = 0.f;
+    // Centre the handle bars.
+    m_steering = 0.f;
+
+    setBaseOrientation ({ Ogre::Degree (-37.784f), Ogre::Vector3::UNIT_X });
 }
 
 #pragma endregion
@@ -62,10 +68,10 @@ bool Badger::HandleBar::initialise (OgreApplication* const ogre, Ogre::SceneNode
 {
     try
     {
-        // Pre-condition: We have a valid OgreApplication and SceneNode pointer.
-        if (!ogre || !root)
+        // Pre-condition: We have a valid SceneNode pointer. A nullptr OgreApplication creates a headless actor.
+        if (!root)
         {
-            throw std::invalid_argument ("Badger::HandleBar::initialise(), required parameter 'ogre' or 'root' is a nullptr.");
+            throw std::invalid_argument ("Badger::HandleBar::initialise(), required parameter 'root' is a nullptr.");
         }
 
         // Initialise the entity.
@@ -94,11 +100,4 @@ bool Badger::HandleBar::initialise (OgreApplication* const ogre, Ogre::SceneNode
     return false;
 }
 
-
-void Badger::HandleBar::updateSimulation (const float deltaTime)
-{
-    // We simply need to rotate the handle bars according to their target turn rate.
-    rotateComponent (Ogre::Vector3::UNIT_Y, Ogre::Node::TS_LOCAL, deltaTime);
-}
-
 #pragma endregion 
\ No newline at end of file
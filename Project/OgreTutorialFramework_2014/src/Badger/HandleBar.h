@@ -45,10 +45,6 @@ class Badger::HandleBar final : public Badger::IRotatableComponent
         /// <returns> Returns whether the initialisation was successful. </returns>
         bool initialise (OgreApplication* const ogre = nullptr, Ogre::SceneNode* const root = nullptr, const Ogre::String& name = { }) override final;
 
-        /// <summary> This will ensure that the orientation of the handle bars proceeds to the target point as time passes. </summary>
-        /// <param name="deltaTime"> The number of seconds passed since the last update. </param>
-        void updateSimulation (const float deltaTime) override final;
-
         #pragma endregion
 
 };
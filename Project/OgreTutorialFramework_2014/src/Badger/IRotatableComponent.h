@@ -9,7 +9,8 @@
 
 
 /// <summary>
-/// An abstract class used to provide the handle bars and wheels with the same rotation mechanics.
+/// An abstract class used to provide the handle bars and wheels with the same rotation mechanics. The steering angle is given by the badger's
+/// VehicleModel and kept as a scalar, the orientation is rebuilt from it rather than reading the yaw back out of the orientation.
 /// </summary>
 class Badger::IRotatableComponent : public IActor
 {
@@ -20,23 +21,26 @@ class Badger::IRotatableComponent : public IActor
 
         #pragma region Getters and setters
 
-        /// <summary> Gets the angle limit of the rotatable component. </summary>
-        float getTurnLimitRadians() const;
+        /// <summary> Gets the current yaw of the component in radians. </summary>
+        float currentYaw() const                    { return m_steering; }
 
-        /// <summary> Gets the turn speed of the component. </summary>
-        float getTurnSpeed() const                  { return m_turnSpeed; }
+        /// <summary> Sets the current yaw of the component in radians and rebuilds the orientation. </summary>
+        void setSteering (const float angle)        { m_steering = angle; updateOrientation(); }
 
-        /// <summary> Gets the target turn value which is a normalised value between -1.f and 1.f. </summary>
-        float getTargetTurn() const                 { return m_targetTurn; }
+        /// <summary> Sets the orientation the component turns from and rebuilds the current orientation. </summary>
+        void setBaseOrientation (const Ogre::Quaternion& orientation);
 
-        /// <summary> Calculates the current yaw of the wheels. </summary>
-        float currentYaw() const;
+        #pragma endregion
+
+        #pragma region State
 
-        /// <summary> Sets the sideways turn speed of the wheels. Negative values may have strange outcomes. </summary>
-        void setTurnSpeed (const float speed)       { m_turnSpeed = speed; }
+        /// <summary> Appends the transform, the base orientation and the steering of the component. </summary>
+        /// <param name="buffer"> The buffer to append to. </param>
+        void saveState (StateBuffer& buffer) const override;
 
-        /// <summary> Sets the target X rotation using a value between -1.f and 1.f, 0.f meaning neutral. </summary>
-        void setTargetTurn (const float target)     { m_targetTurn = target; }
+        /// <summary> Restores the transform, the base orientation and the steering of the component. </summary>
+        /// <param name="buffer"> The buffer to read from. </param>
+        void restoreState (StateBuffer& buffer) override;
 
         #pragma endregion
 
@@ -44,18 +48,18 @@ class Badger::IRotatableComponent : public IActor
 
         #pragma region Animation
 
-        /// <summary> Rotates the object on a given axis based on the target turn and turn speed values available. </summary>
-        /// <param name="axis"> The axis the component should be rotated on. </param>
-        /// <param name="space"> How the rotation should be applied to the component, commonly TS_PARENT and TS_LOCAL. </param>
-        /// <param name="deltaTime"> The delta time used to normalise the rotation speed. </param>
-        void rotateComponent (const Ogre::Vector3& axis, const Ogre::Node::TransformSpace space, const float deltaTime);
-        
+        /// <summary> Builds the orientation of the component from the base orientation and the current angles. </summary>
+        virtual Ogre::Quaternion buildOrientation() const;
+
+        /// <summary> Rebuilds the simulated orientation, this should be called once each step after the angles have changed. </summary>
+        void updateOrientation()                    { m_orientation = buildOrientation(); }
+
         #pragma endregion
 
         #pragma region Implementation data
         
-        float       m_turnSpeed     { 80.f };   //!< The turn rate at which the component rotates sideways in degrees per second.
-        float       m_targetTurn    { 0.f };    //!< A normalised target turn rotation between -1.f and 1.f.
+        Ogre::Quaternion    m_baseOrientation   {  };       //!< The orientation of the component when it isn't turned.
+        float               m_steering          { 0.f };    //!< The current yaw of the component in radians.
 
         #pragma endregion
 
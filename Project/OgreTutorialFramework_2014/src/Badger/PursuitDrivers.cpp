@@ -0,0 +1,230 @@
+#include "PursuitDrivers.h"
+
+
+
+// STL headers.
+#include <cmath>
+#include <exception>
+#include <iostream>
+
+
+
+// Engine headers.
+#include <Badger/Badger.h>
+#include <Badger/BadgerFleet.h>
+#include <Badger/VehicleModel.h>
+#include <Misc/Profiler.h>
+#include <Misc/StateBuffer.h>
+#include <Path/PathSamples.h>
+#include <Utility/Maths.h>
+
+
+
+// Globals.
+const std::size_t   searchWindow    { 32 };     //!< How many samples either side of the previous closest sample are checked each update.
+const float         cornerSlowdown  { 0.5f };   //!< How much of the cruise rate is lost when turning as hard as possible.
+
+
+
+#pragma region Constructors and destructor
+
+PursuitDrivers::PursuitDrivers()
+{
+}
+
+
+PursuitDrivers::PursuitDrivers (PursuitDrivers&& move)
+{
+    *this = std::move (move);
+}
+
+
+PursuitDrivers& PursuitDrivers::operator= (PursuitDrivers&& move)
+{
+    if (this != &move)
+    {
+        m_path = std::move (move.m_path);
+        m_closest = std::move (move.m_closest);
+
+        m_lookahead = move.m_lookahead;
+        m_lookaheadTime = move.m_lookaheadTime;
+        m_cruiseRate = move.m_cruiseRate;
+    }
+
+    return *this;
+}
+
+
+PursuitDrivers::~PursuitDrivers()
+{
+}
+
+#pragma endregion
+
+
+#pragma region Getters and setters
+
+float PursuitDrivers::getProgress (const std::size_t driver) const
+{
+    return m_path->getDistance (m_closest[driver]);
+}
+
+
+void PursuitDrivers::setCruiseRate (const float rate)
+{
+    m_cruiseRate = util::clamp (rate, 0.f, 1.f);
+}
+
+#pragma endregion
+
+
+#pragma region Driver functionality
+
+bool PursuitDrivers::initialise (const std::size_t count, const std::shared_ptr<const PathSamples>& path)
+{
+    try
+    {
+        // Pre-condition: There is a path to follow.
+        if (!path || path->getCount() == 0)
+        {
+            throw std::invalid_argument ("PursuitDrivers::initialise(), required parameter is a nullptr or has no samples.");
+        }
+
+        m_path = path;
+        m_closest.assign (count, 0);
+
+        return true;
+    }
+
+    catch (const std::exception& error)
+    {
+        std::cerr << "An exception was caught in PursuitDrivers::initialise(): " << error.what() << std::endl;
+    }
+
+    catch (...)
+    {
+        std::cerr << "An unknown error occurred in PursuitDrivers::initialise()." << std::endl;
+    }
+
+    return false;
+}
+
+
+void PursuitDrivers::place (BadgerFleet& fleet)
+{
+    const std::size_t   count   { util::min (getCount(), fleet.getCount()) };
+    const float         spacing { m_path->getLength() / util::max (count, static_cast<std::size_t> (1)) };
+
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        // Face towards a point just ahead so badgers start lined up with the path.
+        float x { 0.f }, z { 0.f }, aheadX { 0.f }, aheadZ { 0.f };
+        m_path->pointAt (i * spacing, x, z);
+        m_path->pointAt (i * spacing + 1.f, aheadX, aheadZ);
+
+        fleet.setPosition (i, { x, fleet.getPosition (i).y, z });
+        fleet.setHeading (i, std::atan2 (aheadX - x, aheadZ - z));
+    }
+
+    reset (fleet);
+}
+
+
+void PursuitDrivers::reset (const BadgerFleet& fleet)
+{
+    const std::size_t count { util::min (getCount(), fleet.getCount()) };
+
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        const auto position = fleet.getPosition (i);
+        m_closest[i] = m_path->findClosest (position.x, position.z);
+    }
+}
+
+
+void PursuitDrivers::update (BadgerFleet& fleet)
+{
+    PROFILE_SCOPE ("PursuitDrivers::update");
+
+    const auto&         model   = fleet.getVehicleModel();
+    const std::size_t   count   { util::min (getCount(), fleet.getCount()) };
+
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        const auto position = fleet.getPosition (i);
+        const auto controls = pursue (i, position.x, position.z, fleet.getHeading (i), fleet.getSpeed (i), model.getWheelBase(), model.getAngleLimit());
+
+        fleet.setTurnRate (i, controls.turn);
+        fleet.setSpeedRate (i, controls.speed);
+    }
+}
+
+
+void PursuitDrivers::update (Badger& badger, const std::size_t driver)
+{
+    const auto& state       = badger.getVehicleState();
+    const auto  controls    = pursue (driver, state.x, state.z, state.heading, state.speed, badger.getWheelBase(), badger.getTurnLimitRadians());
+
+    badger.setTurnRate (controls.turn);
+    badger.setSpeedRate (controls.speed);
+}
+
+#pragma endregion
+
+
+#pragma region State
+
+void PursuitDrivers::saveState (StateBuffer& buffer) const
+{
+    buffer.write (m_closest);
+}
+
+
+void PursuitDrivers::restoreState (StateBuffer& buffer)
+{
+    buffer.read (m_closest);
+}
+
+#pragma endregion
+
+
+#pragma region Helper functions
+
+PursuitDrivers::Controls PursuitDrivers::pursue (const std::size_t driver, const float x, const float z, const float heading, const float speed,
+                                                 const float wheelBase, const float angleLimit)
+{
+    m_closest[driver] = m_path->findClosest (x, z, m_closest[driver], searchWindow);
+
+    // Faster badgers look further ahead so they don't weave about the path.
+    float targetX { 0.f }, targetZ { 0.f };
+    m_path->pointAt (m_path->getDistance (m_closest[driver]) + m_lookahead + std::abs (speed) * m_lookaheadTime, targetX, targetZ);
+
+    // Find the target relative to the badger, side is towards where an increasing heading turns.
+    const float offsetX     { targetX - x },
+                offsetZ     { targetZ - z },
+                squared     { offsetX * offsetX + offsetZ * offsetZ },
+                ahead       { offsetX * std::sin (heading) + offsetZ * std::cos (heading) },
+                side        { offsetX * std::cos (heading) - offsetZ * std::sin (heading) };
+
+    if (squared == 0.f)
+    {
+        return { 0.f, m_cruiseRate };
+    }
+
+    // A negative turn rate increases the heading. Targets behind the badger need a full turn, the arc would barely turn at all.
+    float turn { side >= 0.f ? -1.f : 1.f };
+
+    if (ahead > 0.f)
+    {
+        // The arc through the target has a curvature of twice the sideways offset over the squared distance. The model turns by
+        // sin (steering) / wheelBase per metre, which gives the steering needed to follow that arc.
+        const float curvature   { 2.f * side / squared },
+                    steering    { std::asin (util::clamp (curvature * wheelBase, -1.f, 1.f)) };
+
+        turn = util::clamp (-steering / angleLimit, -1.f, 1.f);
+    }
+
+    return { turn, m_cruiseRate * (1.f - cornerSlowdown * std::abs (turn)) };
+}
+
+#pragma endregion
\ No newline at end of file
@@ -0,0 +1,128 @@
+#pragma once
+
+#ifndef _PURSUIT_DRIVERS_
+#define _PURSUIT_DRIVERS_
+
+
+// STL headers.
+#include <memory>
+#include <vector>
+
+
+// Forward declarations.
+class Badger;
+class BadgerFleet;
+class PathSamples;
+class StateBuffer;
+
+
+/// <summary>
+/// Autonomous drivers which follow a path using pure pursuit. Each driver chases a point a little way ahead of its closest point on the path
+/// and converts the arc towards it into a turn rate, so badgers are still simulated by their motion model rather than snapped to the curve.
+/// Every driver shares the same PathSamples and only searches near its previous closest sample, so a whole fleet is driven in one pass.
+/// </summary>
+class PursuitDrivers final
+{
+    public:
+
+        #pragma region Constructors and destructor
+
+        PursuitDrivers();
+
+        PursuitDrivers (PursuitDrivers&& move);
+        PursuitDrivers& operator= (PursuitDrivers&& move);
+
+        ~PursuitDrivers();
+
+        PursuitDrivers (const PursuitDrivers& copy)             = delete;
+        PursuitDrivers& operator= (const PursuitDrivers& copy)  = delete;
+
+        #pragma endregion
+
+        #pragma region Getters and setters
+
+        /// <summary> Gets the number of drivers. </summary>
+        std::size_t getCount() const                        { return m_closest.size(); }
+
+        /// <summary> Gets how far along the lap the closest point of a driver is. </summary>
+        float getProgress (const std::size_t driver) const;
+
+        float getLookahead() const                          { return m_lookahead; }
+        float getLookaheadTime() const                      { return m_lookaheadTime; }
+        float getCruiseRate() const                         { return m_cruiseRate; }
+
+        /// <summary> Sets the shortest distance ahead of the closest point which drivers chase. </summary>
+        void setLookahead (const float distance)            { m_lookahead = distance; }
+
+        /// <summary> Sets how many seconds of travel are added to the lookahead, faster drivers look further ahead so they don't weave. </summary>
+        void setLookaheadTime (const float seconds)         { m_lookaheadTime = seconds; }
+
+        /// <summary> Sets the speed rate used on straights, drivers slow down in proportion to how hard they're turning. </summary>
+        /// <param name="rate"> This will be clamped between 0.f and 1.f. </param>
+        void setCruiseRate (const float rate);
+
+        #pragma endregion
+
+        #pragma region Driver functionality
+
+        /// <summary> Creates the drivers, each driver starts from the first sample until place() or reset() is called. </summary>
+        /// <param name="count"> The number of drivers, usually one per badger in a fleet. </param>
+        /// <param name="path"> The samples to follow, these are shared rather than copied. </param>
+        /// <returns> Whether the initialisation was successful. </returns>
+        bool initialise (const std::size_t count, const std::shared_ptr<const PathSamples>& path);
+
+        /// <summary> Spreads the fleet evenly along the path, facing along it, and starts each driver from its badger. </summary>
+        void place (BadgerFleet& fleet);
+
+        /// <summary> Finds the closest sample to each badger by checking the whole path, use this after badgers are moved. </summary>
+        void reset (const BadgerFleet& fleet);
+
+        /// <summary> Sets the speed and turn rate of every badger in the fleet in a single pass. </summary>
+        void update (BadgerFleet& fleet);
+
+        /// <summary> Sets the speed and turn rate of a single badger. </summary>
+        /// <param name="driver"> The driver controlling the badger. </param>
+        void update (Badger& badger, const std::size_t driver);
+
+        #pragma endregion
+
+        #pragma region State
+
+        /// <summary> Appends the closest sample of each driver so replays search from the same place. </summary>
+        void saveState (StateBuffer& buffer) const;
+
+        /// <summary> Restores the state written by saveState(), there must be the same number of drivers. </summary>
+        void restoreState (StateBuffer& buffer);
+
+        #pragma endregion
+
+    private:
+
+        #pragma region Helper functions
+
+        /// <summary> The controls chosen by a driver. </summary>
+        struct Controls final
+        {
+            float turn, speed;
+        };
+
+        /// <summary> Updates the closest sample of a driver and chooses the controls to reach the lookahead point. </summary>
+        Controls pursue (const std::size_t driver, const float x, const float z, const float heading, const float speed,
+                         const float wheelBase, const float angleLimit);
+
+        #pragma endregion
+
+        #pragma region Implementation data
+
+        std::shared_ptr<const PathSamples>  m_path          { nullptr };    //!< The samples every driver follows.
+        std::vector<std::size_t>            m_closest       {  };           //!< The closest sample to each badger as of the previous update.
+
+        float                               m_lookahead     { 20.f };       //!< The shortest distance ahead of the closest point to chase.
+        float                               m_lookaheadTime { 0.5f };       //!< The seconds of travel added to the lookahead.
+        float                               m_cruiseRate    { 0.5f };       //!< The speed rate used on straights.
+
+        #pragma endregion
+
+};
+
+#endif // _PURSUIT_DRIVERS_
\ No newline at end of file
@@ -0,0 +1,200 @@
+#include "SpeedKernel.h"
+
+
+
+// STL headers.
+#include <cmath>
+#include <vector>
+
+
+
+// Engine headers.
+#include <Utility/Scalar.h>
+#include <Utility/SIMD.h>
+
+
+
+// Globals.
+const float reachedMargin   { 0.001f };     //!< How close the speed rate must be to the target to stop accelerating, the same as Badger.
+
+
+
+namespace kernel
+{
+    #pragma region Scalar
+
+    void integrateSpeedsScalar (const SpeedInput& input, const float deltaTime)
+    {
+        for (std::size_t i = 0; i < input.count; ++i)
+        {
+            const float speed               { input.speeds[i] },
+                        maxSpeed            { input.maxSpeeds[i] },
+                        target              { input.targets[i] },
+                        currentSpeedRate    { speed / maxSpeed };
+
+            if (std::abs (currentSpeedRate - target) <= reachedMargin)
+            {
+                continue;
+            }
+
+            const float modifier { target > currentSpeedRate ? 1.f : -1.f };
+            float       increase { input.acceleration * modifier * deltaTime };
+
+            // Brake when swapping between forward and reverse, accelerating with whatever time is left after stopping.
+            if ((currentSpeedRate > 0.f && target < 0.f) || (currentSpeedRate < 0.f && target > 0.f))
+            {
+                const float deltaBrake      { input.brakePower * deltaTime },
+                            brakeDifference { std::abs (speed) - deltaBrake };
+
+                if (brakeDifference < 0.f)
+                {
+                    const float brakeProportion { std::abs (brakeDifference / input.brakePower) };
+                    increase = (deltaBrake * brakeProportion + input.acceleration * deltaTime * (1.f - brakeProportion)) * modifier;
+                }
+
+                else
+                {
+                    increase = deltaBrake * modifier;
+                }
+            }
+
+            input.speeds[i] = util::clamp (speed + increase, -maxSpeed, maxSpeed);
+        }
+    }
+
+    #pragma endregion
+
+
+    #pragma region Vectorised
+
+    #if BADGER_SIMD
+
+    /// <summary> Picks each lane from a where the mask is set and from b otherwise. </summary>
+    static __m128 select (const __m128 mask, const __m128 a, const __m128 b)
+    {
+        return _mm_or_ps (_mm_and_ps (mask, a), _mm_andnot_ps (mask, b));
+    }
+
+
+    void integrateSpeeds (const SpeedInput& input, const float deltaTime)
+    {
+        // Only whole groups of four are vectorised, the remainder is handled by the scalar version.
+        const std::size_t   vectorCount { input.count & ~static_cast<std::size_t> (3) };
+
+        const __m128    zero            { _mm_setzero_ps() },
+                        one             { _mm_set1_ps (1.f) },
+                        signBit         { _mm_set1_ps (-0.f) },
+                        margin          { _mm_set1_ps (reachedMargin) },
+                        brakePower      { _mm_set1_ps (input.brakePower) },
+                        accelerate      { _mm_set1_ps (input.acceleration * deltaTime) },
+                        deltaBrake      { _mm_set1_ps (input.brakePower * deltaTime) };
+
+        for (std::size_t i = 0; i < vectorCount; i += 4)
+        {
+            const __m128    speed       { _mm_loadu_ps (input.speeds + i) },
+                            maxSpeed    { _mm_loadu_ps (input.maxSpeeds + i) },
+                            target      { _mm_loadu_ps (input.targets + i) },
+                            rate        { _mm_div_ps (speed, maxSpeed) };
+
+            // Lanes which have reached their target keep their current speed.
+            const __m128    reached     { _mm_cmple_ps (_mm_andnot_ps (signBit, _mm_sub_ps (rate, target)), margin) };
+
+            // The modifier is 1.f or -1.f, flipping the sign bit of one is cheaper than a second select.
+            const __m128    modifier    { _mm_or_ps (one, _mm_andnot_ps (_mm_cmpgt_ps (target, rate), signBit)) };
+
+            // Lanes swapping between forward and reverse brake first.
+            const __m128    braking     { _mm_or_ps (_mm_and_ps (_mm_cmpgt_ps (rate, zero), _mm_cmplt_ps (target, zero)),
+                                                     _mm_and_ps (_mm_cmplt_ps (rate, zero), _mm_cmpgt_ps (target, zero))) };
+
+            const __m128    difference  { _mm_sub_ps (_mm_andnot_ps (signBit, speed), deltaBrake) },
+                            proportion  { _mm_andnot_ps (signBit, _mm_div_ps (difference, brakePower)) },
+                            partial     { _mm_add_ps (_mm_mul_ps (deltaBrake, proportion), _mm_mul_ps (accelerate, _mm_sub_ps (one, proportion))) },
+                            brake       { select (_mm_cmplt_ps (difference, zero), partial, deltaBrake) },
+                            increase    { _mm_mul_ps (select (braking, brake, accelerate), modifier) };
+
+            const __m128    sum         { _mm_add_ps (speed, increase) },
+                            clamped     { _mm_max_ps (_mm_min_ps (sum, maxSpeed), _mm_xor_ps (maxSpeed, signBit)) };
+
+            _mm_storeu_ps (input.speeds + i, select (reached, speed, clamped));
+        }
+
+        SpeedInput remainder { input };
+        remainder.speeds += vectorCount;
+        remainder.maxSpeeds += vectorCount;
+        remainder.targets += vectorCount;
+        remainder.count -= vectorCount;
+
+        integrateSpeedsScalar (remainder, deltaTime);
+    }
+
+    #else
+
+    void integrateSpeeds (const SpeedInput& input, const float deltaTime)
+    {
+        integrateSpeedsScalar (input, deltaTime);
+    }
+
+    #endif
+
+    #pragma endregion
+
+
+    #pragma region Verification
+
+    bool verifySpeedKernel()
+    {
+        // Cover stationary, cruising, reversing and every target so each branch of the scalar version is taken, including braking
+        // to a stop part way through a step. An odd count makes sure the scalar remainder is exercised too.
+        const float speedValues[]       { 0.f, 0.5f, 1.f, 30.f, 79.99f, 80.f, -0.5f, -1.f, -30.f, -80.f },
+                    targetValues[]      { -1.f, -0.5f, -0.01f, 0.f, 0.0005f, 0.01f, 0.5f, 1.f },
+                    maxSpeedValues[]    { 80.f, 40.f, 120.f };
+
+        std::vector<float> speeds {  }, maxSpeeds {  }, targets {  };
+
+        for (const float speed : speedValues)
+        {
+            for (const float target : targetValues)
+            {
+                for (const float maxSpeed : maxSpeedValues)
+                {
+                    speeds.push_back (speed);
+                    targets.push_back (target);
+                    maxSpeeds.push_back (maxSpeed);
+                }
+            }
+        }
+
+        speeds.push_back (10.f);
+        targets.push_back (-1.f);
+        maxSpeeds.push_back (80.f);
+
+        auto expected = speeds;
+
+        SpeedInput scalar {  };
+        scalar.speeds = expected.data();
+        scalar.maxSpeeds = maxSpeeds.data();
+        scalar.targets = targets.data();
+        scalar.count = expected.size();
+        scalar.acceleration = 15.f;
+        scalar.brakePower = 100.f;
+
+        SpeedInput vectorised { scalar };
+        vectorised.speeds = speeds.data();
+
+        // Run several steps of differing lengths so the speeds pass through braking, accelerating and reaching the target.
+        for (const float deltaTime : simd::verificationSteps)
+        {
+            integrateSpeedsScalar (scalar, deltaTime);
+            integrateSpeeds (vectorised, deltaTime);
+
+            if (!simd::compare ("kernel::verifySpeedKernel()", expected.data(), speeds.data(), speeds.size(), 0.0001f))
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    #pragma endregion
+}
\ No newline at end of file
@@ -0,0 +1,41 @@
+#pragma once
+
+#ifndef _SPEED_KERNEL_
+#define _SPEED_KERNEL_
+
+
+// STL headers.
+#include <cstddef>
+
+
+namespace kernel
+{
+    /// <summary> The arrays and tuning values needed to integrate the speed of many badgers at once. </summary>
+    struct SpeedInput final
+    {
+        float*          speeds          { nullptr };    //!< The current speed of each badger, this is updated in place.
+        const float*    maxSpeeds       { nullptr };    //!< The maximum speed of each badger.
+        const float*    targets         { nullptr };    //!< The target speed rate of each badger between -1.f and 1.f.
+        std::size_t     count           { 0 };          //!< How many badgers are in each array.
+        float           acceleration    { 0.f };        //!< How quickly a badger can change its current speed.
+        float           brakePower      { 0.f };        //!< How quickly a badger can brake.
+    };
+
+
+    /// <summary> Accelerates or brakes each badger towards its target speed, one badger at a time. This mirrors Badger::updateSpeed(). </summary>
+    /// <param name="deltaTime"> The number of seconds passed since the last update. </param>
+    void integrateSpeedsScalar (const SpeedInput& input, const float deltaTime);
+
+    /// <summary>
+    /// Gives the same results as integrateSpeedsScalar() but processes four badgers per instruction without branching, each case is
+    /// calculated for every lane and the correct result is selected with masks. Falls back to the scalar version without SSE2.
+    /// </summary>
+    /// <param name="deltaTime"> The number of seconds passed since the last update. </param>
+    void integrateSpeeds (const SpeedInput& input, const float deltaTime);
+
+    /// <summary> Runs both versions over every combination of braking, accelerating and reaching the target and compares the results. </summary>
+    /// <returns> Whether every speed matched within a small tolerance. </returns>
+    bool verifySpeedKernel();
+}
+
+#endif // _SPEED_KERNEL_
\ No newline at end of file
@@ -0,0 +1,202 @@
+#include "VehicleModel.h"
+
+
+
+// STL headers.
+#include <cmath>
+#include <iostream>
+
+
+
+// Engine headers.
+#include <Badger/SpeedKernel.h>
+
+
+
+// Helper functions.
+
+/// <summary> The rate of change of the position and heading for a given heading, speed and steering. </summary>
+struct Motion final
+{
+    float x, z, heading;
+};
+
+
+/// <summary> Evaluates the kinematic bicycle model. </summary>
+static Motion evaluate (const VehicleModel& model, const float heading, const float speed, const float steering)
+{
+    return { std::sin (heading) * speed, std::cos (heading) * speed, model.turnFor (speed, steering) };
+}
+
+
+
+#pragma region Simulation
+
+void VehicleModel::step (VehicleState& state, const float deltaTime) const
+{
+    switch (m_integrator)
+    {
+        case Integrator::SemiImplicit:
+            stepSemiImplicit (state, deltaTime);
+            break;
+
+        case Integrator::RungeKutta4:
+            stepRungeKutta4 (state, deltaTime);
+            break;
+
+        default:
+            stepEuler (state, deltaTime);
+            break;
+    }
+}
+
+
+void VehicleModel::updateSpeed (VehicleState& state, const float deltaTime) const
+{
+    // The fleet kernel is the single implementation of the speed rules, a single vehicle is just a fleet of one.
+    kernel::SpeedInput input {  };
+    input.speeds = &state.speed;
+    input.maxSpeeds = &state.maxSpeed;
+    input.targets = &state.targetSpeedRate;
+    input.count = 1;
+    input.acceleration = m_acceleration;
+    input.brakePower = m_brakePower;
+
+    kernel::integrateSpeedsScalar (input, deltaTime);
+}
+
+
+void VehicleModel::move (VehicleState& state, const float distance) const
+{
+    // The rear wheels follow the front wheels, turning the vehicle by an amount proportional to the steering.
+    state.x += std::sin (state.heading) * distance;
+    state.z += std::cos (state.heading) * distance;
+    state.heading = util::wrapAngle (state.heading + turnFor (distance, state.steering));
+
+    revolve (state, distance);
+}
+
+
+void VehicleModel::steer (VehicleState& state, const float deltaTime) const
+{
+    // Never overshoot the target, even with a large delta time.
+    state.steering = steerTowards (state.steering, state.targetTurn, deltaTime);
+}
+
+
+void VehicleModel::revolve (VehicleState& state, const float distance) const
+{
+    state.wheelSpin = util::wrapAngle (state.wheelSpin + spinFor (distance));
+}
+
+
+bool VehicleModel::verifyIntegrators()
+{
+    // Weave at full throttle, swapping the turn every second so every step rate changes the controls at the same moment. The route stops
+    // short of top speed because where the speed settles depends on the step size, not the integrator. Stepping a float state much faster
+    // than the reference only adds rounding error.
+    const unsigned int  seconds         { 5 },
+                        referenceRate   { 2400 };
+
+    const auto drive = [=] (const Integrator integrator, const unsigned int rate)
+    {
+        VehicleModel model {  };
+        model.setIntegrator (integrator);
+
+        VehicleState state {  };
+        state.targetSpeedRate = 1.f;
+
+        const float deltaTime { 1.f / rate };
+
+        for (unsigned int second = 0; second < seconds; ++second)
+        {
+            state.targetTurn = second % 2 == 0 ? 1.f : -1.f;
+
+            for (unsigned int i = 0; i < rate; ++i)
+            {
+                model.step (state, deltaTime);
+            }
+        }
+
+        return state;
+    };
+
+    const auto reference = drive (Integrator::RungeKutta4, referenceRate);
+
+    const auto error = [&] (const VehicleState& state)
+    {
+        return std::sqrt ((state.x - reference.x) * (state.x - reference.x) + (state.z - reference.z) * (state.z - reference.z));
+    };
+
+    const float rungeKutta  { error (drive (Integrator::RungeKutta4, 30)) },
+                euler       { error (drive (Integrator::Euler, 240)) };
+
+    if (rungeKutta >= euler)
+    {
+        std::cerr << "VehicleModel::verifyIntegrators(), Runge-Kutta at 30 Hz finished " << rungeKutta << "m from the reference but Euler at 240 Hz finished "
+                  << euler << "m away." << std::endl;
+
+        return false;
+    }
+
+    return true;
+}
+
+#pragma endregion
+
+
+#pragma region Integrators
+
+void VehicleModel::stepEuler (VehicleState& state, const float deltaTime) const
+{
+    updateSpeed (state, deltaTime);
+    move (state, state.speed * deltaTime);
+    steer (state, deltaTime);
+}
+
+
+void VehicleModel::stepSemiImplicit (VehicleState& state, const float deltaTime) const
+{
+    updateSpeed (state, deltaTime);
+    steer (state, deltaTime);
+
+    // Moving along the new heading keeps turning circles closed instead of spiralling outwards.
+    const float distance { state.speed * deltaTime };
+    state.heading = util::wrapAngle (state.heading + turnFor (distance, state.steering));
+    state.x += std::sin (state.heading) * distance;
+    state.z += std::cos (state.heading) * distance;
+
+    revolve (state, distance);
+}
+
+
+void VehicleModel::stepRungeKutta4 (VehicleState& state, const float deltaTime) const
+{
+    // The speed and steering don't depend on the position or heading, so their values part way through the step are found by
+    // stepping copies of the state with the usual rules.
+    const float halfTime { deltaTime * 0.5f };
+
+    VehicleState middle { state }, end { state };
+    updateSpeed (middle, halfTime);
+    steer (middle, halfTime);
+    updateSpeed (end, deltaTime);
+    steer (end, deltaTime);
+
+    const auto k1 = evaluate (*this, state.heading, state.speed, state.steering);
+    const auto k2 = evaluate (*this, state.heading + k1.heading * halfTime, middle.speed, middle.steering);
+    const auto k3 = evaluate (*this, state.heading + k2.heading * halfTime, middle.speed, middle.steering);
+    const auto k4 = evaluate (*this, state.heading + k3.heading * deltaTime, end.speed, end.steering);
+
+    const float weight      { deltaTime / 6.f },
+                distance    { (state.speed + middle.speed * 4.f + end.speed) * weight };
+
+    state.x += (k1.x + 2.f * (k2.x + k3.x) + k4.x) * weight;
+    state.z += (k1.z + 2.f * (k2.z + k3.z) + k4.z) * weight;
+    state.heading = util::wrapAngle (state.heading + (k1.heading + 2.f * (k2.heading + k3.heading) + k4.heading) * weight);
+    state.speed = end.speed;
+    state.steering = end.steering;
+
+    revolve (state, distance);
+}
+
+#pragma endregion
\ No newline at end of file
@@ -0,0 +1,148 @@
+#pragma once
+
+#ifndef _VEHICLE_MODEL_
+#define _VEHICLE_MODEL_
+
+
+// STL headers.
+#include <cmath>
+
+
+// Engine headers.
+#include <Utility/Scalar.h>
+
+
+/// <summary>
+/// The complete simulated state of a single vehicle. This is plain data so it can be copied, snapshotted and stepped anywhere.
+/// </summary>
+struct VehicleState final
+{
+    float   x               { 0.f };    //!< The position on the x axis.
+    float   y               { 0.f };    //!< The position on the y axis, vehicles never leave the ground.
+    float   z               { 0.f };    //!< The position on the z axis.
+    float   heading         { 0.f };    //!< The rotation about the y axis in radians, zero faces along the z axis.
+    float   speed           { 0.f };    //!< How quickly the vehicle is currently moving.
+    float   maxSpeed        { 80.f };   //!< The maximum speed of the vehicle in metres per second.
+    float   targetSpeedRate { 0.f };    //!< A normalised value between -1.f and 1.f which represents the desired speed.
+    float   steering        { 0.f };    //!< The yaw of the handle bars and front wheels in radians.
+    float   targetTurn      { 0.f };    //!< A normalised target turn between -1.f and 1.f.
+    float   wheelSpin       { 0.f };    //!< How far the wheels have revolved in radians.
+};
+
+
+/// <summary>
+/// A kinematic bicycle model which steps a VehicleState. It knows nothing of Ogre or the scene graph, so vehicles can be stepped on any
+/// thread, in batch runs and in tests without any rendering overhead. Each step accelerates, moves and turns, then steers.
+/// </summary>
+class VehicleModel final
+{
+    public:
+
+        /// <summary>
+        /// How the position and heading are integrated over a step. The speed and steering follow piecewise linear ramps which are
+        /// stepped exactly, so only the turning of the vehicle benefits from a higher order method.
+        /// </summary>
+        enum class Integrator
+        {
+            Euler,          //!< Moves along the heading and steering at the start of the step, the same order as the original Badger.
+            SemiImplicit,   //!< Updates the speed, steering and heading first, then moves along the new heading.
+            RungeKutta4     //!< Samples the motion at the start, middle and end of the step, accurate at much larger steps.
+        };
+
+        #pragma region Getters and setters
+
+        float getWheelBase() const                      { return m_wheelBase; }
+        float getAcceleration() const                   { return m_acceleration; }
+        float getBrakePower() const                     { return m_brakePower; }
+        float getTurnSpeed() const                      { return m_turnSpeed; }
+        float getAngleLimit() const                     { return m_angleLimit; }
+        float getWheelDiameter() const                  { return m_wheelDiameter; }
+        Integrator getIntegrator() const                { return m_integrator; }
+
+        void setWheelBase (const float wheelBase)       { m_wheelBase = wheelBase; }
+        void setAcceleration (const float acceleration) { m_acceleration = acceleration; }
+        void setBrakePower (const float brakePower)     { m_brakePower = brakePower; }
+        void setTurnSpeed (const float turnSpeed)       { m_turnSpeed = turnSpeed; }
+        void setAngleLimit (const float angleLimit)     { m_angleLimit = angleLimit; }
+        void setWheelDiameter (const float diameter)    { m_wheelDiameter = diameter; }
+        void setIntegrator (const Integrator integrator) { m_integrator = integrator; }
+
+        #pragma endregion
+
+        #pragma region Rules
+
+        /// <summary> Gets the steering after turning towards a normalised target turn for the given time. A positive turn steers right. </summary>
+        float steerTowards (const float steering, const float targetTurn, const float deltaTime) const
+        {
+            return util::approach (steering, -(m_angleLimit * targetTurn), m_turnSpeed * (util::pi / 180.f) * deltaTime);
+        }
+
+        /// <summary> Gets how far the heading turns in radians when travelling the given distance, the rear wheels follow the front wheels. </summary>
+        float turnFor (const float distance, const float steering) const    { return distance * std::sin (steering) / m_wheelBase; }
+
+        /// <summary> Gets how far the wheels revolve in radians when travelling the given distance, a revolution covers the circumference. </summary>
+        float spinFor (const float distance) const                          { return util::twoPi * distance / (m_wheelDiameter * util::pi); }
+
+        #pragma endregion
+
+        #pragma region Simulation
+
+        /// <summary> Performs a complete simulation step using the chosen integrator. </summary>
+        /// <param name="deltaTime"> The number of seconds passed since the last step. </param>
+        void step (VehicleState& state, const float deltaTime) const;
+
+        /// <summary> Accelerates or brakes towards the target speed, braking first when swapping between forward and reverse. </summary>
+        /// <param name="deltaTime"> The number of seconds passed since the last step. </param>
+        void updateSpeed (VehicleState& state, const float deltaTime) const;
+
+        /// <summary> Moves the vehicle forward, turning it according to the steering and revolving the wheels. </summary>
+        /// <param name="distance"> The distance in metres to travel. </param>
+        void move (VehicleState& state, const float distance) const;
+
+        /// <summary> Turns the steering towards the target turn without ever overshooting. </summary>
+        /// <param name="deltaTime"> The number of seconds passed since the last step. </param>
+        void steer (VehicleState& state, const float deltaTime) const;
+
+        /// <summary> Revolves the wheels as if the vehicle had travelled the given distance. </summary>
+        /// <param name="distance"> The distance in metres travelled. </param>
+        void revolve (VehicleState& state, const float distance) const;
+
+        /// <summary>
+        /// Drives the same weaving route with Runge-Kutta at 30 Hz and Euler at 240 Hz, comparing where each finishes against Runge-Kutta at
+        /// 2400 Hz. Runge-Kutta should finish closer despite taking an eighth of the steps.
+        /// </summary>
+        /// <returns> Whether Runge-Kutta was the more accurate, the errors are written to std::cerr otherwise. </returns>
+        static bool verifyIntegrators();
+
+        #pragma endregion
+
+    private:
+
+        #pragma region Integrators
+
+        /// <summary> Accelerates, moves along the current heading and steering, then steers. </summary>
+        void stepEuler (VehicleState& state, const float deltaTime) const;
+
+        /// <summary> Accelerates and steers, turns using the new speed and steering, then moves along the new heading. </summary>
+        void stepSemiImplicit (VehicleState& state, const float deltaTime) const;
+
+        /// <summary> Integrates the position and heading with the classic fourth order Runge-Kutta method. </summary>
+        void stepRungeKutta4 (VehicleState& state, const float deltaTime) const;
+
+        #pragma endregion
+
+        #pragma region Implementation data
+
+        float   m_wheelBase     { 8.f };            //!< The length between the front and rear wheels.
+        float   m_acceleration  { 15.f };           //!< How quickly the vehicle can change its current speed.
+        float   m_brakePower    { 100.f };          //!< How quickly the vehicle can brake.
+        float   m_turnSpeed     { 80.f };           //!< The rate at which the steering turns in degrees per second.
+        float   m_angleLimit    { 0.34906585f };    //!< The largest steering angle in radians.
+        float   m_wheelDiameter { 7.f };            //!< The wheel diameter in metres.
+        Integrator  m_integrator    { Integrator::Euler };  //!< How each step is integrated. Without the original thresholds on tiny moves, replays from before the model differ slightly.
+
+        #pragma endregion
+
+};
+
+#endif // _VEHICLE_MODEL_
\ No newline at end of file
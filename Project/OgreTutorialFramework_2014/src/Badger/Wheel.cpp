@@ -8,6 +8,11 @@
 
 
 
+// Engine headers.
+#include <Misc/StateBuffer.h>
+
+
+
 #pragma region Constructors and destructor
 
 Badger::Wheel::Wheel (Wheel&& move)
@@ -22,14 +27,19 @@ Badger::Wheel& Badger::Wheel::operator= (Wheel&& move)
     {
         // IActor.
         m_node = std::move (move.m_node);
+        m_position = std::move (move.m_position);
+        m_orientation = std::move (move.m_orientation);
+        m_scale = std::move (move.m_scale);
+        m_previousPosition = std::move (move.m_previousPosition);
+        m_previousOrientation = std::move (move.m_previousOrientation);
 
         // Badger::IRotatableComponent.
-        m_turnSpeed = std::move (move.m_turnSpeed);
-        m_targetTurn = std::move (move.m_targetTurn);
+        m_baseOrientation = std::move (move.m_baseOrientation);
+        m_steering = std::move (move.m_steering);
 
         // Badger::Wheel.
-        m_diameter = std::move (move.m_diameter);
         m_revolveModifier = std::move (move.m_revolveModifier);
+        m_spin = std::move (move.m_spin);
     }
 
     return *this;
@@ -45,13 +55,24 @@ Badger::Wheel::~Wheel()
 
 #pragma region Getters and setters
 
+void Badger::Wheel::setAngles (const float steering, const float spin)
+{
+    m_steering = steering;
+    m_spin = spin * m_revolveModifier;
+
+    updateOrientation();
+}
+
+
 void Badger::Wheel::reset()
 {
-    // We don't reset the position or orientation because we just can't know how the wheels should be placed.
-    m_node->setScale ({ 1.f, 1.f, 1.f });
+    // We don't reset the position or base orientation because we just can't know how the wheels should be placed.
+    setScale ({ 1.f, 1.f, 1.f });
+
+    m_steering = 0.f;
+    m_spin = 0.f;
 
-    m_targetTurn = 0.f;
-    m_node->yaw (Ogre::Radian (0.f));
+    updateOrientation();
 }
 
 #pragma endregion
@@ -63,10 +84,10 @@ bool Badger::Wheel::initialise (OgreApplication* const ogre, Ogre::SceneNode* ro
 {
     try
     {
-        // Pre-condition: We have a valid OgreApplication and SceneNode pointer.
-        if (!ogre || !root)
+        // Pre-condition: We have a valid SceneNode pointer. A nullptr OgreApplication creates a headless actor.
+        if (!root)
         {
-            throw std::invalid_argument ("Badger::Wheel::initialise(), required parameter 'ogre' or 'root' is a nullptr.");
+            throw std::invalid_argument ("Badger::Wheel::initialise(), required parameter 'root' is a nullptr.");
         }
 
         // Initialise the entity.
@@ -95,32 +116,38 @@ bool Badger::Wheel::initialise (OgreApplication* const ogre, Ogre::SceneNode* ro
     return false;
 }
 
+#pragma endregion
+
+
+#pragma region State
 
-void Badger::Wheel::updateSimulation (const float deltaTime)
+void Badger::Wheel::saveState (StateBuffer& buffer) const
 {
-    // Rotate the wheels sideways.
-    rotateComponent (Ogre::Vector3::UNIT_Y, Ogre::Node::TS_PARENT, deltaTime);
+    IRotatableComponent::saveState (buffer);
+    buffer.write (m_revolveModifier);
+    buffer.write (m_spin);
+}
+
+
+void Badger::Wheel::restoreState (StateBuffer& buffer)
+{
+    IRotatableComponent::restoreState (buffer);
+    buffer.read (m_revolveModifier);
+    buffer.read (m_spin);
 }
 
 #pragma endregion
 
 
-#pragma region Simulation
+#pragma region Animation
 
-void Badger::Wheel::revolve (const float distance)
+Ogre::Quaternion Badger::Wheel::buildOrientation() const
 {
-    // Obtain the necessary constants for calculate the correct rotation.
-    const float fullRevolution  { Ogre::Math::TWO_PI },
-                pi              { Ogre::Math::PI };
+    // Steering is applied in parent space and the spin in local space, so they sit either side of the base orientation.
+    const Ogre::Quaternion  steering    { Ogre::Radian (m_steering), Ogre::Vector3::UNIT_Y },
+                            spin        { Ogre::Radian (m_spin), Ogre::Vector3::UNIT_Y };
 
-    // Calculate how much to revolve the wheel by.
-    const float circumference   { m_diameter  * pi },
-                toRotate        { fullRevolution * (distance / circumference) * m_revolveModifier };
-
-    // Rotate the wheel.
-    const auto  rotation        = Ogre::Quaternion (Ogre::Radian (toRotate), Ogre::Vector3::UNIT_Y);
-    
-    m_node->rotate (rotation, Ogre::Node::TS_LOCAL);
+    return steering * m_baseOrientation * spin;
 }
 
 #pragma endregion
\ No newline at end of file
@@ -9,7 +9,7 @@
 
 
 /// <summary>
-/// A basic wheel class which features clamped y-rotation functionality and can be revolved by a given distance at will.
+/// A basic wheel class which steers and spins about its axle, both angles are given by the badger's VehicleModel.
 /// </summary>
 class Badger::Wheel final : public Badger::IRotatableComponent
 {
@@ -31,15 +31,16 @@ class Badger::Wheel final : public Badger::IRotatableComponent
 
         #pragma region Getters and setters
   
-        float getDiameter() const                       { return m_diameter; }
         float getRevolveModifier() const                { return m_revolveModifier; }
 
-        /// <summary> Sets the wheels diameter, this effects how fast the wheels should revolve based on a distance. </summary>
-        void setDiameter (const float diameter)         { m_diameter = diameter; }
-
         /// <summary> Used to change how revolutions are applied. -1.f will cause a reverse rotation. </summary>
         void setRevolveModifier (const float modifier)  { m_revolveModifier = modifier; }
 
+        /// <summary> Sets the steering and the spin together and rebuilds the orientation once. </summary>
+        /// <param name="steering"> The yaw of the wheel in radians. </param>
+        /// <param name="spin"> How far the wheel has revolved in radians, the revolve modifier is applied to this. </param>
+        void setAngles (const float steering, const float spin);
+
         /// <summary> Will reset the rotation animator to stationary settings. </summary>
         void reset();
 
@@ -54,17 +55,26 @@ class Badger::Wheel final : public Badger::IRotatableComponent
         /// <returns> Returns whether the initialisation was successful. </returns>
         bool initialise (OgreApplication* const ogre = nullptr, Ogre::SceneNode* const root = nullptr, const Ogre::String& name = { }) override final;
 
-        /// <summary> This will ensure that the orientation of the wheels proceeds to the target point as time passes. </summary>
-        /// <param name="deltaTime"> The number of seconds passed since the last update. </param>
-        void updateSimulation (const float deltaTime) override final;
+        #pragma endregion
+
+        #pragma region State
+
+        /// <summary> Appends the wheel state including the spin and the revolve modifier, which is otherwise only calculated when the badger sets up its wheels. </summary>
+        /// <param name="buffer"> The buffer to append to. </param>
+        void saveState (StateBuffer& buffer) const override final;
+
+        /// <summary> Restores the wheel state including the spin and the revolve modifier. </summary>
+        /// <param name="buffer"> The buffer to read from. </param>
+        void restoreState (StateBuffer& buffer) override final;
 
         #pragma endregion
 
-        #pragma region Simulation
+    protected:
+
+        #pragma region Animation
 
-        /// <summary> Revolves the wheels to indicate a forward motion based on distance value. </summary>
-        /// <param name="distance"> A distance in metres to simulate. </param>
-        void revolve (const float distance);
+        /// <summary> Wheels steer in the space of the badger whilst spinning about their own axle. </summary>
+        Ogre::Quaternion buildOrientation() const override final;
 
         #pragma endregion
 
@@ -72,8 +82,8 @@ class Badger::Wheel final : public Badger::IRotatableComponent
 
         #pragma region Implementation data
 
-        float       m_diameter          { 7.f };    //!< The wheel diameter in metres. 
         float       m_revolveModifier   { 1.f };    //!< A modifier used to change the way revolutions are applied. Should be clamped between -1.f and 1.f, fixes wrong rotation direction.
+        float       m_spin              { 0.f };    //!< How far the wheel has revolved about its axle in radians.
 
         #pragma endregion
 
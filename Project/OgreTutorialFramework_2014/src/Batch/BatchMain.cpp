@@ -0,0 +1,88 @@
+// STL headers.
+#include <exception>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+
+
+
+// Engine headers.
+#include <Badger/VehicleModel.h>
+#include <Batch/BatchRunner.h>
+#include <Misc/Profiler.h>
+#include <Utility/SIMD.h>
+
+
+
+/// <summary> Writes the expected command line arguments to the console. </summary>
+void printUsage()
+{
+    std::cout << "Usage: BadgerBatch <path.xml> [steps] [step size in seconds] [agents] [fleet size] [threads] [deterministic 0/1]"
+                 " [integrator 0 Euler/1 semi-implicit/2 Runge-Kutta 4]" << std::endl;
+}
+
+
+int main (int argc, char* argv[])
+{
+    // Pre-condition: We need at least a path file.
+    if (argc < 2 || argc > 9)
+    {
+        printUsage();
+        return 1;
+    }
+
+    // Parse the command line, anything not given keeps its default value.
+    BatchRunner::Settings settings {  };
+
+    try
+    {
+        settings.pathFile = argv[1];
+
+        if (argc > 2) settings.steps = std::stoul (argv[2]);
+        if (argc > 3) settings.stepSize = std::stof (argv[3]);
+        if (argc > 4) settings.agents = std::stoul (argv[4]);
+        if (argc > 5) settings.fleet = std::stoul (argv[5]);
+        if (argc > 6) settings.threads = std::stoul (argv[6]);
+        if (argc > 7) settings.deterministic = std::stoul (argv[7]) != 0;
+
+        if (argc > 8)
+        {
+            const auto integrator = std::stoul (argv[8]);
+
+            if (integrator > static_cast<unsigned long> (VehicleModel::Integrator::RungeKutta4))
+            {
+                throw std::out_of_range ("integrator");
+            }
+
+            settings.integrator = static_cast<VehicleModel::Integrator> (integrator);
+        }
+    }
+
+    catch (const std::exception&)
+    {
+        std::cerr << "Invalid arguments given." << std::endl;
+        printUsage();
+        return 1;
+    }
+
+    // The fleet and badgers rely on the vectorised functions so they must agree with their scalar versions, and the integrators must be as
+    // accurate as they claim to be.
+    if (!simd::verifyAll() || !VehicleModel::verifyIntegrators())
+    {
+        return 1;
+    }
+
+    // Run the batch.
+    BatchRunner runner {  };
+
+    if (!runner.initialise (settings))
+    {
+        return 1;
+    }
+
+    PROFILE_THREAD_NAME ("BadgerBatch");
+    runner.run();
+    PROFILE_DUMP ("BadgerBatch-trace.json");
+
+    return 0;
+}
\ No newline at end of file
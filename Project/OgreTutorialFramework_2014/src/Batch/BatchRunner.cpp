@@ -0,0 +1,345 @@
+#include "BatchRunner.h"
+
+
+
+// STL headers.
+#include <chrono>
+#include <cmath>
+#include <exception>
+#include <iostream>
+
+
+
+// Ogre headers.
+#include <OgreLogManager.h>
+
+
+
+// Engine headers.
+#include <Misc/JobSystem.h>
+#include <Path/Path.h>
+#include <Simulation/BadgerSimulator.h>
+#include <Simulation/PathSimulator.h>
+#include <Utility/Maths.h>
+
+
+
+// Globals.
+const std::size_t agentsPerJob  { 16 };     //!< How many agents of one type are updated by each job, enough to outweigh the cost of queueing.
+const std::size_t badgersPerJob { 1024 };   //!< How many badgers of the fleet are updated by each job, each is far cheaper than an agent.
+
+/// <summary> The name of each integrator, indexed by VehicleModel::Integrator. </summary>
+const char* const integratorNames[] { "Euler", "semi-implicit Euler", "Runge-Kutta 4" };
+
+
+
+#pragma region Constructors and destructor
+
+BatchRunner::BatchRunner()
+{
+}
+
+
+BatchRunner::BatchRunner (BatchRunner&& move)
+{
+    *this = std::move (move);
+}
+
+
+BatchRunner& BatchRunner::operator= (BatchRunner&& move)
+{
+    if (this != &move)
+    {
+        // Release our own resources before taking ownership.
+        cleanUp();
+
+        // BatchRunner.
+        m_settings = std::move (move.m_settings);
+
+        m_logManager = move.m_logManager;
+        m_root = move.m_root;
+        m_sceneManager = move.m_sceneManager;
+
+        m_path = std::move (move.m_path);
+        m_jobs = std::move (move.m_jobs);
+
+        m_pathSimulators = std::move (move.m_pathSimulators);
+        m_badgerSimulators = std::move (move.m_badgerSimulators);
+        m_fleet = std::move (move.m_fleet);
+
+        m_initialState = std::move (move.m_initialState);
+
+        // Prevent the moved object from destroying Ogre.
+        move.m_logManager = nullptr;
+        move.m_root = nullptr;
+        move.m_sceneManager = nullptr;
+    }
+
+    return *this;
+}
+
+
+BatchRunner::~BatchRunner()
+{
+    cleanUp();
+}
+
+#pragma endregion
+
+
+#pragma region Public interface
+
+bool BatchRunner::initialise (const Settings& settings)
+{
+    try
+    {
+        // Pre-condition: We have something to simulate.
+        if (settings.steps == 0 || settings.agents == 0 || settings.stepSize <= 0.f)
+        {
+            throw std::invalid_argument ("BatchRunner::initialise(), steps, agents and step size must all be positive.");
+        }
+
+        cleanUp();
+        m_settings = settings;
+
+        // A log manager must exist before the root otherwise Ogre will create a noisy default log.
+        m_logManager = new Ogre::LogManager();
+        m_logManager->createLog ("BadgerBatch.log", true, false, true);
+
+        // We don't load any plugins because nothing is ever rendered.
+        m_root = new Ogre::Root ("", "", "");
+        m_sceneManager = m_root->createSceneManager (Ogre::ST_GENERIC, "BatchSceneManager");
+
+        const auto root = m_sceneManager->getRootSceneNode();
+
+        // Agents are independent so they can be updated on every thread.
+        m_jobs = std::make_unique<JobSystem> (m_settings.threads);
+        m_jobs->setDeterministic (m_settings.deterministic);
+
+        // Load the path once and share it between every agent.
+        m_path = std::make_shared<Path>();
+
+        if (!m_path->loadFromXML (m_settings.pathFile))
+        {
+            throw std::runtime_error ("BatchRunner::initialise(), unable to load the path \"" + m_settings.pathFile + "\".");
+        }
+
+        // Create each agent.
+        m_pathSimulators.resize (m_settings.agents);
+        m_badgerSimulators.resize (m_settings.agents);
+
+        for (unsigned int i = 0; i < m_settings.agents; ++i)
+        {
+            const auto index = std::to_string (i);
+
+            m_pathSimulators[i] = std::make_unique<PathSimulator>();
+            m_pathSimulators[i]->setReportSegments (false);
+
+            if (!m_pathSimulators[i]->initialise (root, m_path, "BatchPath-" + index))
+            {
+                throw std::runtime_error ("BatchRunner::initialise(), unable to initialise a PathSimulator.");
+            }
+
+            m_badgerSimulators[i] = std::make_unique<BadgerSimulator>();
+
+            if (!m_badgerSimulators[i]->initialise (root, "BatchBadger-" + index))
+            {
+                throw std::runtime_error ("BatchRunner::initialise(), unable to initialise a BadgerSimulator.");
+            }
+
+            m_badgerSimulators[i]->setIntegrator (m_settings.integrator);
+        }
+
+        // The fleet has no nodes, it only exists to measure how many badgers can be simulated.
+        if (m_settings.fleet > 0 && !m_fleet.initialise (m_settings.fleet))
+        {
+            throw std::runtime_error ("BatchRunner::initialise(), unable to initialise the BadgerFleet.");
+        }
+
+        // Every agent has just been reset so this is where each run should begin.
+        saveState (m_initialState);
+
+        return true;
+    }
+
+    catch (const std::exception& error)
+    {
+        std::cerr << "Exception caught in BatchRunner::initialise(): " << error.what() << std::endl;
+    }
+
+    catch (...)
+    {
+        std::cerr << "An unknown error was caught in BatchRunner::initialise()." << std::endl;
+    }
+
+    cleanUp();
+    return false;
+}
+
+
+void BatchRunner::run()
+{
+    // Each run starts from the beginning, copying the initial state is much cheaper than resetting every agent.
+    restoreState (m_initialState);
+
+    // Only the simulation itself is timed.
+    const auto start = std::chrono::steady_clock::now();
+
+    for (unsigned int step = 0; step < m_settings.steps; ++step)
+    {
+        const float time { step * m_settings.stepSize };
+
+        // Every agent owns its badger and only reads the shared path, so chunks of agents and the fleet can all be updated at once.
+        JobSystem::TaskGroup group {  };
+
+        for (std::size_t begin = 0; begin < m_pathSimulators.size(); begin += agentsPerJob)
+        {
+            const std::size_t end { util::min (begin + agentsPerJob, m_pathSimulators.size()) };
+
+            m_jobs->run (group, [this, begin, end] ()
+            {
+                for (std::size_t i = begin; i < end; ++i)
+                {
+                    m_pathSimulators[i]->update (m_settings.stepSize);
+                }
+            });
+        }
+
+        for (std::size_t begin = 0; begin < m_badgerSimulators.size(); begin += agentsPerJob)
+        {
+            const std::size_t end { util::min (begin + agentsPerJob, m_badgerSimulators.size()) };
+
+            m_jobs->run (group, [this, begin, end, time] ()
+            {
+                for (std::size_t i = begin; i < end; ++i)
+                {
+                    // Drive each badger at full speed whilst weaving from side to side, offset so each agent is different.
+                    m_badgerSimulators[i]->setControls (1.f, std::sin (time + static_cast<float> (i)));
+                    m_badgerSimulators[i]->update (m_settings.stepSize);
+                }
+            });
+        }
+
+        // The fleet is split into ranges whilst the agents are queued, waiting on the ranges also helps with the agents.
+        m_fleet.prepareUpdate();
+
+        m_jobs->parallelFor (m_fleet.getCount(), badgersPerJob, [this, time] (const std::size_t begin, const std::size_t end)
+        {
+            for (std::size_t i = begin; i < end; ++i)
+            {
+                m_fleet.setSpeedRate (i, 1.f);
+                m_fleet.setTurnRate (i, std::sin (time + static_cast<float> (i)));
+            }
+
+            m_fleet.updateSimulation (begin, end, m_settings.stepSize);
+        });
+
+        m_jobs->wait (group);
+    }
+
+    const auto end = std::chrono::steady_clock::now();
+
+    report (std::chrono::duration<double> (end - start).count());
+}
+
+#pragma endregion
+
+
+#pragma region Helper functions
+
+void BatchRunner::report (const double seconds) const
+{
+    const double    agentSteps      { static_cast<double> (m_settings.steps) * (m_pathSimulators.size() + m_badgerSimulators.size() + m_fleet.getCount()) },
+                    simulatedTime   { static_cast<double> (m_settings.steps) * m_settings.stepSize };
+
+    std::cout << "Path: " << m_settings.pathFile << ", length: " << m_path->getLength() << ", segments: " << m_path->getSegmentCount() << std::endl;
+    std::cout << "Steps: " << m_settings.steps << ", step size: " << m_settings.stepSize << " seconds, agents: " << m_settings.agents << " of each simulator, fleet: " << m_settings.fleet << " badgers." << std::endl;
+    std::cout << "Threads: " << (m_jobs->getWorkerCount() + 1) << (m_jobs->isDeterministic() ? ", deterministic." : ".") << std::endl;
+    std::cout << "Integrator: " << integratorNames[static_cast<std::size_t> (m_settings.integrator)] << "." << std::endl;
+
+    // Every PathSimulator follows the same path at the same pace so the first is representative.
+    const auto& laps = m_pathSimulators.front()->getLapTimes();
+
+    for (unsigned int i = 0; i < laps.size(); ++i)
+    {
+        std::cout << "Lap " << (i + 1) << ": " << laps[i] << " seconds." << std::endl;
+    }
+
+    if (laps.empty())
+    {
+        std::cout << "No laps were completed, try increasing the step count." << std::endl;
+    }
+
+    std::cout << "Simulated " << simulatedTime << " seconds in " << seconds << " seconds (" << (simulatedTime / seconds) << "x real time)." << std::endl;
+    std::cout << "Throughput: " << static_cast<unsigned long long> (agentSteps / seconds) << " agent-steps per second." << std::endl;
+}
+
+
+void BatchRunner::saveState (StateBuffer& buffer) const
+{
+    buffer.clear();
+
+    for (const auto& simulator : m_pathSimulators)
+    {
+        simulator->saveState (buffer);
+    }
+
+    for (const auto& simulator : m_badgerSimulators)
+    {
+        simulator->saveState (buffer);
+    }
+
+    m_fleet.saveState (buffer);
+}
+
+
+void BatchRunner::restoreState (StateBuffer& buffer)
+{
+    buffer.rewind();
+
+    for (auto& simulator : m_pathSimulators)
+    {
+        simulator->restoreState (buffer);
+    }
+
+    for (auto& simulator : m_badgerSimulators)
+    {
+        simulator->restoreState (buffer);
+    }
+
+    m_fleet.restoreState (buffer);
+}
+
+
+void BatchRunner::cleanUp()
+{
+    // Agents must be destroyed before the scene they live in.
+    m_pathSimulators.clear();
+    m_badgerSimulators.clear();
+    m_fleet = BadgerFleet();
+    m_initialState.clear();
+    m_path = nullptr;
+
+    // No jobs are outstanding between steps so the workers can simply be stopped.
+    m_jobs = nullptr;
+
+    if (m_root)
+    {
+        if (m_sceneManager)
+        {
+            m_root->destroySceneManager (m_sceneManager);
+            m_sceneManager = nullptr;
+        }
+
+        delete m_root;
+        m_root = nullptr;
+    }
+
+    if (m_logManager)
+    {
+        delete m_logManager;
+        m_logManager = nullptr;
+    }
+}
+
+#pragma endregion
\ No newline at end of file
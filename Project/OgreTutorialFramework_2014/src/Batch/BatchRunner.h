@@ -0,0 +1,119 @@
+#pragma once
+
+#ifndef _BATCH_RUNNER_
+#define _BATCH_RUNNER_
+
+
+// STL headers.
+#include <memory>
+#include <string>
+#include <vector>
+
+
+// Engine headers.
+#include <Badger/BadgerFleet.h>
+#include <Badger/VehicleModel.h>
+#include <Misc/StateBuffer.h>
+
+
+// Forward declarations.
+class BadgerSimulator;
+class JobSystem;
+class Path;
+class PathSimulator;
+
+
+/// <summary>
+/// Runs the path and badger simulations without a window as fast as possible, reporting lap times and throughput.
+/// </summary>
+class BatchRunner final
+{
+    public:
+
+        /// <summary>
+        /// The parameters of a batch run, usually obtained from the command line.
+        /// </summary>
+        struct Settings final
+        {
+            std::string     pathFile      { "path.xml" };    //!< The XML file containing the path to follow.
+            unsigned int    steps         { 100000 };        //!< How many simulation steps to perform.
+            float           stepSize      { 1.f / 60.f };    //!< The delta time in seconds of each step.
+            unsigned int    agents        { 1 };             //!< The number of PathSimulator and BadgerSimulator agents to create of each type.
+            unsigned int    fleet         { 0 };             //!< The number of badgers in a BadgerFleet stepped alongside the agents.
+            unsigned int    threads       { 0 };             //!< How many worker threads update agents alongside the main thread.
+            bool            deterministic { false };         //!< Whether every job runs serially on the main thread in submission order, for replays.
+
+            VehicleModel::Integrator integrator { VehicleModel::Integrator::Euler };    //!< How each BadgerSimulator steps its badger, the fleet always uses Euler.
+        };
+
+        #pragma region Constructors and destructor
+
+        BatchRunner();
+
+        BatchRunner (BatchRunner&& move);
+        BatchRunner& operator= (BatchRunner&& move);
+
+        ~BatchRunner();
+
+        BatchRunner (const BatchRunner& copy)               = delete;
+        BatchRunner& operator= (const BatchRunner& copy)    = delete;
+
+        #pragma endregion
+
+        #pragma region Public interface
+
+        /// <summary> Creates a headless Ogre scene and every agent required by the given settings. </summary>
+        /// <param name="settings"> The parameters to run the batch with. </param>
+        /// <returns> Whether the initialisation was successful. </returns>
+        bool initialise (const Settings& settings);
+
+        /// <summary>
+        /// Steps every agent the requested number of times and writes the results to the console. Agents own their badgers so they're updated in
+        /// chunks across every thread, as are ranges of the fleet. The results are identical whether or not the run is deterministic, but a
+        /// deterministic run executes every chunk serially on the main thread so it gains nothing from the worker threads.
+        /// </summary>
+        void run();
+
+        #pragma endregion
+
+    private:
+
+        #pragma region Helper functions
+
+        /// <summary> Writes the lap times and throughput of the most recent run to the console. </summary>
+        /// <param name="seconds"> The wall clock time that the run took. </param>
+        void report (const double seconds) const;
+
+        /// <summary> Captures the state of every agent. </summary>
+        void saveState (StateBuffer& buffer) const;
+
+        /// <summary> Restores every agent to a state captured by saveState(). </summary>
+        void restoreState (StateBuffer& buffer);
+
+        /// <summary> Releases each agent and the headless Ogre scene. </summary>
+        void cleanUp();
+
+        #pragma endregion
+
+        #pragma region Implementation data
+
+        Settings                                        m_settings          {  };           //!< The settings given upon initialisation.
+
+        Ogre::LogManager*                               m_logManager        { nullptr };    //!< A silent log manager so Ogre doesn't flood the console.
+        Ogre::Root*                                     m_root              { nullptr };    //!< The Ogre root, created without any render system.
+        Ogre::SceneManager*                             m_sceneManager      { nullptr };    //!< Owns every SceneNode used by the agents.
+
+        std::shared_ptr<Path>                           m_path              { nullptr };    //!< The path shared by every PathSimulator.
+        std::unique_ptr<JobSystem>                      m_jobs              { nullptr };    //!< Updates independent agents across every thread.
+
+        std::vector<std::unique_ptr<PathSimulator>>     m_pathSimulators    {  };           //!< Badgers following the path.
+        std::vector<std::unique_ptr<BadgerSimulator>>   m_badgerSimulators  {  };           //!< Badgers driven by scripted controls.
+        BadgerFleet                                     m_fleet             {  };           //!< Many more badgers driven by scripted controls, stored as arrays.
+
+        StateBuffer                                     m_initialState      {  };           //!< Every agent directly after initialisation, restored at the start of each run.
+
+        #pragma endregion
+
+};
+
+#endif // _BATCH_RUNNER_
\ No newline at end of file
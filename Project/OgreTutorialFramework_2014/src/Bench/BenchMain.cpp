@@ -0,0 +1,130 @@
+// STL headers.
+#include <exception>
+#include <iostream>
+#include <string>
+
+
+
+// Ogre headers.
+#include <OgreLogManager.h>
+
+
+
+// Engine headers.
+#include <Badger/VehicleModel.h>
+#include <Bench/Benchmark.h>
+#include <Bench/BenchmarkCases.h>
+#include <Utility/SIMD.h>
+
+
+
+/// <summary> Writes the expected command line arguments to the console. </summary>
+void printUsage()
+{
+    std::cout   << "Usage: BadgerBench [--output <results.json>] [--baseline <baseline.json>] [--threshold <percent>] [--filter <text>] [--quick]" << std::endl
+                << "  --output     Where to write the results, defaults to BadgerBench.json." << std::endl
+                << "  --baseline   Compares the results against a previous run, the exit code is 2 if any case regressed." << std::endl
+                << "  --threshold  How many percent slower a case may become before it's a regression, defaults to 10." << std::endl
+                << "  --filter     Only runs cases whose name contains the text, e.g. Segment::." << std::endl
+                << "  --quick      Takes fewer, shorter samples. Useful for a smoke test but too noisy to compare." << std::endl;
+}
+
+
+int main (int argc, char* argv[])
+{
+    // Parse the command line, anything not given keeps its default value.
+    Benchmark::Settings settings {  };
+
+    std::string output      { "BadgerBench.json" },
+                baseline    {  };
+    double      threshold   { 10.0 };
+
+    try
+    {
+        for (int i = 1; i < argc; ++i)
+        {
+            const std::string argument  { argv[i] };
+            const bool        hasValue  { i + 1 < argc };
+
+            if (argument == "--output" && hasValue)         output = argv[++i];
+            else if (argument == "--baseline" && hasValue)  baseline = argv[++i];
+            else if (argument == "--threshold" && hasValue) threshold = std::stod (argv[++i]);
+            else if (argument == "--filter" && hasValue)    settings.filter = argv[++i];
+            else if (argument == "--quick")
+            {
+                settings.batchTime = 0.01;
+                settings.samples = 5;
+                settings.budget = 0.5;
+            }
+
+            else
+            {
+                throw std::invalid_argument (argument);
+            }
+        }
+    }
+
+    catch (const std::exception&)
+    {
+        std::cerr << "Invalid arguments given." << std::endl;
+        printUsage();
+        return 1;
+    }
+
+    // Make sure the vectorised functions agree with their scalar versions before timing them, and that Runge-Kutta still earns its extra cost.
+    if (!simd::verifyAll() || !VehicleModel::verifyIntegrators())
+    {
+        return 1;
+    }
+
+    // Actors need a scene to live in, just like BadgerBatch nothing is ever rendered.
+    auto logManager = new Ogre::LogManager();
+    logManager->createLog ("BadgerBench.log", true, false, true);
+
+    auto ogreRoot = new Ogre::Root ("", "", "");
+    auto sceneManager = ogreRoot->createSceneManager (Ogre::ST_GENERIC, "BenchSceneManager");
+
+    int result { 0 };
+
+    try
+    {
+        // The cases must be destroyed before the scene they live in.
+        Benchmark benchmark {  };
+        bench::registerCases (benchmark, sceneManager->getRootSceneNode());
+
+        const auto results = benchmark.run (settings);
+
+        if (!Benchmark::writeJSON (output, results))
+        {
+            result = 1;
+        }
+
+        // Compare against the baseline so regressions are obvious in review.
+        if (!baseline.empty())
+        {
+            std::vector<Benchmark::Result> previous {  };
+
+            if (!Benchmark::readJSON (baseline, previous))
+            {
+                result = 1;
+            }
+
+            else if (Benchmark::compare (results, previous, threshold) > 0)
+            {
+                result = 2;
+            }
+        }
+    }
+
+    catch (const std::exception& error)
+    {
+        std::cerr << "Exception caught in BadgerBench: " << error.what() << std::endl;
+        result = 1;
+    }
+
+    ogreRoot->destroySceneManager (sceneManager);
+    delete ogreRoot;
+    delete logManager;
+
+    return result;
+}
\ No newline at end of file
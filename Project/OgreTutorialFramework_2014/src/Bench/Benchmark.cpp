@@ -0,0 +1,305 @@
+#include "Benchmark.h"
+
+
+
+// STL headers.
+#include <algorithm>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+
+
+
+// Engine headers.
+#include <Utility/Maths.h>
+
+
+
+// Globals.
+const unsigned long maxIterations   { 1UL << 30 };  //!< Prevents the batch size overflowing when the body is optimised away entirely.
+
+
+
+// Helper functions.
+
+/// <summary> Writes a string to a stream as a JSON string literal. </summary>
+static void writeJSONString (std::ostream& stream, const std::string& text)
+{
+    stream << '"';
+
+    for (const auto character : text)
+    {
+        if (character == '"' || character == '\\')
+        {
+            stream << '\\';
+        }
+
+        stream << character;
+    }
+
+    stream << '"';
+}
+
+
+/// <summary> Finds the numeric value of a key within the given range of a JSON document. </summary>
+/// <returns> The value, or zero if the key wasn't found. </returns>
+static double readJSONNumber (const std::string& json, const std::string& key, const std::size_t begin, const std::size_t end)
+{
+    const auto position = json.find ("\"" + key + "\"", begin);
+
+    if (position == std::string::npos || position >= end)
+    {
+        return 0.0;
+    }
+
+    const auto colon = json.find (':', position);
+
+    return colon == std::string::npos ? 0.0 : std::strtod (json.c_str() + colon + 1, nullptr);
+}
+
+
+
+#pragma region Constructors and destructor
+
+Benchmark::Benchmark (Benchmark&& move)
+{
+    *this = std::move (move);
+}
+
+
+Benchmark& Benchmark::operator= (Benchmark&& move)
+{
+    if (this != &move)
+    {
+        // Benchmark.
+        m_cases = std::move (move.m_cases);
+    }
+
+    return *this;
+}
+
+#pragma endregion
+
+
+#pragma region Public interface
+
+void Benchmark::add (const std::string& name, const Body& body)
+{
+    m_cases.push_back (std::make_pair (name, body));
+}
+
+
+std::vector<Benchmark::Result> Benchmark::run (const Settings& settings) const
+{
+    std::vector<Result> results {  };
+
+    for (const auto& benchmark : m_cases)
+    {
+        if (!settings.filter.empty() && benchmark.first.find (settings.filter) == std::string::npos)
+        {
+            continue;
+        }
+
+        results.push_back (measure (benchmark.first, benchmark.second, settings));
+
+        const auto& result = results.back();
+
+        std::cout   << std::left << std::setw (48) << result.name << std::right << std::fixed << std::setprecision (1)
+                    << std::setw (16) << result.nsPerOp << " ns/op" 
+                    << "  (" << result.iterations << " x " << result.samples << ")" << std::endl;
+    }
+
+    return results;
+}
+
+#pragma endregion
+
+
+#pragma region Serialisation
+
+bool Benchmark::writeJSON (const std::string& file, const std::vector<Result>& results)
+{
+    std::ofstream output { file, std::ios::out | std::ios::trunc };
+
+    if (!output.is_open())
+    {
+        std::cerr << "Benchmark::writeJSON(), unable to open \"" << file << "\"." << std::endl;
+        return false;
+    }
+
+    output << std::fixed << std::setprecision (3) << "{\n\"benchmarks\": [";
+
+    for (std::size_t i = 0; i < results.size(); ++i)
+    {
+        const auto& result = results[i];
+
+        // One result per line keeps baseline diffs readable in review.
+        output << (i == 0 ? "\n" : ",\n") << "{\"name\": ";
+        writeJSONString (output, result.name);
+        output  << ", \"iterations\": " << result.iterations << ", \"samples\": " << result.samples 
+                << ", \"ns_per_op\": " << result.nsPerOp << ", \"min_ns_per_op\": " << result.minNsPerOp 
+                << ", \"max_ns_per_op\": " << result.maxNsPerOp << "}";
+    }
+
+    output << "\n]\n}" << std::endl;
+
+    return output.good();
+}
+
+
+bool Benchmark::readJSON (const std::string& file, std::vector<Result>& results)
+{
+    std::ifstream input { file };
+
+    if (!input.is_open())
+    {
+        std::cerr << "Benchmark::readJSON(), unable to open \"" << file << "\"." << std::endl;
+        return false;
+    }
+
+    std::stringstream buffer {  };
+    buffer << input.rdbuf();
+    const auto json = buffer.str();
+
+    // We only need to understand the files we write so each result is found by its name.
+    const std::string key { "\"name\"" };
+    auto position = json.find (key);
+
+    while (position != std::string::npos)
+    {
+        const auto open     = json.find ('"', json.find (':', position));
+        const auto close    = json.find ('"', open + 1);
+
+        if (open == std::string::npos || close == std::string::npos)
+        {
+            break;
+        }
+
+        // The properties of this result end where the next result starts.
+        const auto next     = json.find (key, close);
+        const auto end      = next == std::string::npos ? json.size() : next;
+
+        Result result {  };
+        result.name = json.substr (open + 1, close - open - 1);
+        result.iterations = static_cast<unsigned long> (readJSONNumber (json, "iterations", close, end));
+        result.samples = static_cast<unsigned int> (readJSONNumber (json, "samples", close, end));
+        result.nsPerOp = readJSONNumber (json, "ns_per_op", close, end);
+        result.minNsPerOp = readJSONNumber (json, "min_ns_per_op", close, end);
+        result.maxNsPerOp = readJSONNumber (json, "max_ns_per_op", close, end);
+
+        results.push_back (result);
+        position = next;
+    }
+
+    return true;
+}
+
+
+unsigned int Benchmark::compare (const std::vector<Result>& results, const std::vector<Result>& baseline, const double threshold)
+{
+    unsigned int regressions { 0 };
+
+    std::cout   << std::endl << std::left << std::setw (48) << "Case" << std::right << std::setw (16) << "Baseline ns" 
+                << std::setw (16) << "Current ns" << std::setw (10) << "Change" << std::endl;
+
+    for (const auto& result : results)
+    {
+        const auto match = std::find_if (baseline.cbegin(), baseline.cend(), [&] (const Result& previous) { return previous.name == result.name; });
+
+        std::cout << std::left << std::setw (48) << result.name << std::right << std::fixed << std::setprecision (1);
+
+        if (match == baseline.cend() || match->nsPerOp <= 0.0)
+        {
+            std::cout << std::setw (16) << "-" << std::setw (16) << result.nsPerOp << std::setw (10) << "new" << std::endl;
+            continue;
+        }
+
+        const double change { (result.nsPerOp - match->nsPerOp) / match->nsPerOp * 100.0 };
+
+        std::cout   << std::setw (16) << match->nsPerOp << std::setw (16) << result.nsPerOp 
+                    << std::setw (9) << std::showpos << change << std::noshowpos << "%";
+
+        if (change > threshold)
+        {
+            std::cout << "  REGRESSION";
+            ++regressions;
+        }
+
+        else if (change < -threshold)
+        {
+            std::cout << "  improved";
+        }
+
+        std::cout << std::endl;
+    }
+
+    std::cout << std::endl << regressions << " regression(s) beyond " << threshold << "%." << std::endl;
+
+    return regressions;
+}
+
+#pragma endregion
+
+
+#pragma region Helper functions
+
+Benchmark::Result Benchmark::measure (const std::string& name, const Body& body, const Settings& settings)
+{
+    Ogre::Timer timer {  };
+
+    Result result {  };
+    result.name = name;
+    result.iterations = 1;
+
+    // Grow the batch until it takes long enough to time accurately, this also warms the caches.
+    double spent { 0.0 };
+
+    while (true)
+    {
+        timer.reset();
+        body (result.iterations);
+        const double seconds { timer.getMicroseconds() * 0.000001 };
+
+        spent += seconds;
+
+        if (seconds >= settings.batchTime || result.iterations >= maxIterations)
+        {
+            break;
+        }
+
+        // Aim slightly beyond the target so we rarely need another attempt.
+        const double scale { seconds > 0.0 ? settings.batchTime / seconds * 1.2 : 10.0 };
+        result.iterations = static_cast<unsigned long> (result.iterations * util::clamp (scale, 2.0, 10.0));
+    }
+
+    // Time each batch, slow cases stop early once the budget has been spent.
+    std::vector<double> perOp {  };
+
+    for (unsigned int i = 0; i < util::max (settings.samples, 1U); ++i)
+    {
+        if (i >= settings.minSamples && spent >= settings.budget)
+        {
+            break;
+        }
+
+        timer.reset();
+        body (result.iterations);
+        const double seconds { timer.getMicroseconds() * 0.000001 };
+
+        spent += seconds;
+        perOp.push_back (seconds * 1000000000.0 / result.iterations);
+    }
+
+    std::sort (perOp.begin(), perOp.end());
+
+    result.samples = static_cast<unsigned int> (perOp.size());
+    result.nsPerOp = perOp[perOp.size() / 2];
+    result.minNsPerOp = perOp.front();
+    result.maxNsPerOp = perOp.back();
+
+    return result;
+}
+
+#pragma endregion
\ No newline at end of file
@@ -0,0 +1,112 @@
+#pragma once
+
+#ifndef _BENCHMARK_
+#define _BENCHMARK_
+
+
+// STL headers.
+#include <functional>
+#include <string>
+#include <vector>
+
+
+/// <summary>
+/// A minimal microbenchmark harness. Each case is timed in batches large enough for the timer to be accurate, the median of several batches
+/// is reported so that one-off interruptions don't skew results. Results are written as JSON and can be compared against a saved baseline.
+/// </summary>
+class Benchmark final
+{
+    public:
+
+        /// <summary> The code being measured, it must perform the given number of operations. </summary>
+        typedef std::function<void (const unsigned long iterations)> Body;
+
+        /// <summary>
+        /// The timing of a single case.
+        /// </summary>
+        struct Result final
+        {
+            std::string     name        {  };       //!< The unique name of the case, parameters are appended after a '/'.
+            unsigned long   iterations  { 0 };      //!< The number of operations in each batch.
+            unsigned int    samples     { 0 };      //!< The number of batches timed.
+            double          nsPerOp     { 0.0 };    //!< The median time of a single operation in nanoseconds.
+            double          minNsPerOp  { 0.0 };    //!< The fastest batch, per operation.
+            double          maxNsPerOp  { 0.0 };    //!< The slowest batch, per operation.
+        };
+
+        /// <summary>
+        /// Controls how long each case is measured for.
+        /// </summary>
+        struct Settings final
+        {
+            double          batchTime   { 0.05 };   //!< The minimum duration in seconds of each batch.
+            unsigned int    samples     { 15 };     //!< The number of batches to time.
+            unsigned int    minSamples  { 3 };      //!< Slow cases stop early once the budget is spent, but never before this many batches.
+            double          budget      { 3.0 };    //!< The rough time limit in seconds for each case.
+            std::string     filter      {  };       //!< Only cases containing this text are run, empty runs every case.
+        };
+
+        #pragma region Constructors and destructor
+
+        Benchmark()                                     = default;
+
+        Benchmark (Benchmark&& move);
+        Benchmark& operator= (Benchmark&& move);
+
+        ~Benchmark()                                    = default;
+
+        Benchmark (const Benchmark& copy)               = delete;
+        Benchmark& operator= (const Benchmark& copy)    = delete;
+
+        #pragma endregion
+
+        #pragma region Public interface
+
+        /// <summary> Registers a case to be run. </summary>
+        /// <param name="name"> The unique name of the case. </param>
+        /// <param name="body"> The code to measure. </param>
+        void add (const std::string& name, const Body& body);
+
+        /// <summary> Times every case which matches the filter, writing progress to the console. </summary>
+        /// <param name="settings"> Controls how long each case is measured for. </param>
+        /// <returns> The result of each case in the order they were added. </returns>
+        std::vector<Result> run (const Settings& settings) const;
+
+        #pragma endregion
+
+        #pragma region Serialisation
+
+        /// <summary> Writes results to a JSON file. </summary>
+        /// <returns> Whether the file could be written. </returns>
+        static bool writeJSON (const std::string& file, const std::vector<Result>& results);
+
+        /// <summary> Reads results previously written by writeJSON(). </summary>
+        /// <param name="results"> Filled with every result found in the file. </param>
+        /// <returns> Whether the file could be read. </returns>
+        static bool readJSON (const std::string& file, std::vector<Result>& results);
+
+        /// <summary> Writes a table comparing each result with the baseline result of the same name. </summary>
+        /// <param name="threshold"> How many percent slower a case may become before it counts as a regression. </param>
+        /// <returns> The number of regressions found. </returns>
+        static unsigned int compare (const std::vector<Result>& results, const std::vector<Result>& baseline, const double threshold);
+
+        #pragma endregion
+
+    private:
+
+        #pragma region Helper functions
+
+        /// <summary> Times a single case. </summary>
+        static Result measure (const std::string& name, const Body& body, const Settings& settings);
+
+        #pragma endregion
+
+        #pragma region Implementation data
+
+        std::vector<std::pair<std::string, Body>>   m_cases {  };   //!< Every registered case in order.
+
+        #pragma endregion
+
+};
+
+#endif // _BENCHMARK_
\ No newline at end of file
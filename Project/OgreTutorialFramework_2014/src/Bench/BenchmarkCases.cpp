@@ -0,0 +1,546 @@
+#include "BenchmarkCases.h"
+
+
+
+// STL headers.
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+
+
+// Engine headers.
+#include <Badger/Badger.h>
+#include <Badger/BadgerFleet.h>
+#include <Badger/PursuitDrivers.h>
+#include <Badger/SpeedKernel.h>
+#include <Bench/Benchmark.h>
+#include <Misc/JobSystem.h>
+#include <Misc/StateBuffer.h>
+#include <Misc/TweenSystem.h>
+#include <Path/Path.h>
+#include <Path/PathSamples.h>
+#include <Path/Segment.h>
+#include <Utility/Maths.h>
+
+
+
+// Globals.
+volatile float sink { 0.f };    //!< Every case writes its result here so the optimiser can't remove the work being measured.
+
+
+
+/// <summary>
+/// A path XML file which is generated the first time it's needed and removed once no case refers to it.
+/// </summary>
+class GeneratedPath final
+{
+    public:
+
+        GeneratedPath (const unsigned int segments)
+            : m_file ("bench-path-" + std::to_string (segments) + ".xml"), m_segments (segments) 
+        {
+        }
+
+        ~GeneratedPath()
+        {
+            if (m_written)
+            {
+                std::remove (m_file.c_str());
+            }
+        }
+
+        GeneratedPath (const GeneratedPath& copy)               = delete;
+        GeneratedPath& operator= (const GeneratedPath& copy)    = delete;
+
+        /// <summary> Gets the location of the file, writing it if necessary. </summary>
+        const std::string& getFile()
+        {
+            if (!m_written)
+            {
+                write();
+                m_written = true;
+            }
+
+            return m_file;
+        }
+
+        /// <summary> Gets a path loaded from the file, loading it if necessary. </summary>
+        const Path& getPath()
+        {
+            if (!m_path)
+            {
+                m_path = std::make_unique<Path>();
+
+                if (!m_path->loadFromXML (getFile()))
+                {
+                    throw std::runtime_error ("GeneratedPath::getPath(), unable to load \"" + m_file + "\".");
+                }
+            }
+
+            return *m_path;
+        }
+
+    private:
+
+        /// <summary> Writes a winding path in the same format as path.xml, few samples are used so loading isn't dominated by calculateLength(). </summary>
+        void write() const
+        {
+            std::ofstream output { m_file, std::ios::out | std::ios::trunc };
+
+            if (!output.is_open())
+            {
+                throw std::runtime_error ("GeneratedPath::write(), unable to open \"" + m_file + "\".");
+            }
+
+            output << "<?xml version=\"1.0\" encoding=\"utf-8\"?>\n<Path Name=\"Generated\" SamplesPerSegment=\"10\" ForceContinuity=\"true\">\n";
+
+            for (unsigned int i = 0; i < m_segments; ++i)
+            {
+                output << "\t<Segment>\n";
+
+                for (unsigned int point = 0; point < 4; ++point)
+                {
+                    const float x { i * 30.f + point * 10.f },
+                                z { 20.f * std::sin (i + point * 0.5f) };
+
+                    output << "\t\t<Point X=\"" << x << "\" Y=\"4\" Z=\"" << z << "\" />\n";
+                }
+
+                output << "\t</Segment>\n";
+            }
+
+            output << "</Path>\n";
+        }
+
+        std::string             m_file      {  };           //!< The location of the file.
+        unsigned int            m_segments  { 0 };          //!< How many segments the file contains.
+        bool                    m_written   { false };      //!< Whether the file has been written yet.
+        std::unique_ptr<Path>   m_path      { nullptr };    //!< The loaded path, if requested.
+};
+
+
+
+// Helper functions.
+
+/// <summary> Creates a delta which sweeps across the curve as the iteration increases. </summary>
+static float sweep (const unsigned long iteration)
+{
+    return (iteration & 1023) / 1023.f;
+}
+
+
+/// <summary> Adds a case for Segment::curvePoint() with the given derivative. </summary>
+static void addCurvePoint (Benchmark& benchmark, const std::string& name, const Derivative derivative)
+{
+    const auto segment = std::make_shared<Path::Segment> (Ogre::Vector3 (0.f, 4.f, 0.f), Ogre::Vector3 (0.f, 4.f, 25.f), 
+                                                          Ogre::Vector3 (25.f, 4.f, 25.f), Ogre::Vector3 (25.f, 4.f, 0.f));
+
+    benchmark.add ("Segment::curvePoint/" + name, [=] (const unsigned long iterations)
+    {
+        Ogre::Vector3 total {  };
+
+        for (unsigned long i = 0; i < iterations; ++i)
+        {
+            total += segment->curvePoint (sweep (i), derivative);
+        }
+
+        sink = total.x + total.y + total.z;
+    });
+}
+
+
+
+namespace bench
+{
+    void registerCases (Benchmark& benchmark, Ogre::SceneNode* const root)
+    {
+        // Segment::curvePoint for each derivative.
+        addCurvePoint (benchmark, "None", Derivative::None);
+        addCurvePoint (benchmark, "First", Derivative::First);
+        addCurvePoint (benchmark, "Second", Derivative::Second);
+
+        // Segment::calculateLength at different sample counts.
+        for (const unsigned int samples : { 10U, 100U, 1000U, 10000U })
+        {
+            auto segment = std::make_shared<Path::Segment> (Ogre::Vector3 (-50.f, 4.f, -50.f), Ogre::Vector3 (-5.f, 4.f, 50.f), 
+                                                            Ogre::Vector3 (5.f, 4.f, 50.f), Ogre::Vector3 (50.f, 4.f, -50.f));
+
+            benchmark.add ("Segment::calculateLength/" + std::to_string (samples), [=] (const unsigned long iterations)
+            {
+                float total { 0.f };
+
+                for (unsigned long i = 0; i < iterations; ++i)
+                {
+                    total += segment->calculateLength (samples);
+                }
+
+                sink = total;
+            });
+        }
+
+        // Path::loadFromXML, the file is generated outside of the timed region by the first call.
+        for (const unsigned int segments : { 10U, 100U, 1000U, 10000U, 100000U, 1000000U })
+        {
+            const auto generated = std::make_shared<GeneratedPath> (segments);
+
+            benchmark.add ("Path::loadFromXML/" + std::to_string (segments), [=] (const unsigned long iterations)
+            {
+                const auto& file = generated->getFile();
+
+                Path path {  };
+
+                for (unsigned long i = 0; i < iterations; ++i)
+                {
+                    path.loadFromXML (file);
+                }
+
+                sink = path.getLength();
+            });
+        }
+
+        // Path::segmentByDistance on paths of different lengths.
+        for (const unsigned int segments : { 10U, 1000U, 100000U })
+        {
+            const auto generated = std::make_shared<GeneratedPath> (segments);
+
+            benchmark.add ("Path::segmentByDistance/" + std::to_string (segments), [=] (const unsigned long iterations)
+            {
+                const auto& path    = generated->getPath();
+                const float length  { path.getLength() };
+
+                float total { 0.f };
+
+                for (unsigned long i = 0; i < iterations; ++i)
+                {
+                    // Visit the whole path rather than repeatedly hitting the same segment.
+                    total += path.segmentByDistance (sweep (i) * length)->getLength();
+                }
+
+                sink = total;
+            });
+        }
+
+        // Badger::updateSimulation whilst driving straight and turning.
+        for (const float turn : { 0.f, 1.f })
+        {
+            const auto badger = std::make_shared<Badger>();
+
+            if (!badger->initialise (nullptr, root, "BenchBadger-" + std::to_string (static_cast<int> (turn))))
+            {
+                throw std::runtime_error ("bench::registerCases(), unable to initialise a Badger.");
+            }
+
+            benchmark.add (std::string ("Badger::updateSimulation/") + (turn == 0.f ? "Straight" : "Turning"), [=] (const unsigned long iterations)
+            {
+                // Start each batch from the same state so batches are comparable.
+                badger->reset();
+                badger->setSpeedRate (1.f);
+                badger->setTurnRate (turn);
+
+                for (unsigned long i = 0; i < iterations; ++i)
+                {
+                    badger->updateSimulation (1.f / 60.f);
+                }
+
+                sink = badger->getPosition().x;
+            });
+        }
+
+        // Badger::updateSimulation across a thousand independent badgers, updated in order and then in chunks on every core.
+        {
+            const auto jobs     = std::make_shared<JobSystem> (util::max (std::thread::hardware_concurrency(), 2u) - 1);
+            const auto badgers  = std::make_shared<std::vector<std::unique_ptr<Badger>>>();
+
+            for (unsigned int i = 0; i < 1000; ++i)
+            {
+                badgers->push_back (std::make_unique<Badger>());
+
+                if (!badgers->back()->initialise (nullptr, root, "BenchJobBadger-" + std::to_string (i)))
+                {
+                    throw std::runtime_error ("bench::registerCases(), unable to initialise a Badger.");
+                }
+            }
+
+            for (const bool deterministic : { true, false })
+            {
+                benchmark.add (std::string ("Badger::updateSimulation/1000/") + (deterministic ? "Serial" : "Jobs"), [=] (const unsigned long iterations)
+                {
+                    jobs->setDeterministic (deterministic);
+
+                    for (std::size_t i = 0; i < badgers->size(); ++i)
+                    {
+                        (*badgers)[i]->reset();
+                        (*badgers)[i]->setSpeedRate (1.f);
+                        (*badgers)[i]->setTurnRate (std::sin (static_cast<float> (i)));
+                    }
+
+                    for (unsigned long i = 0; i < iterations; ++i)
+                    {
+                        jobs->parallelFor (badgers->size(), 32, [&] (const std::size_t begin, const std::size_t end)
+                        {
+                            for (std::size_t badger = begin; badger < end; ++badger)
+                            {
+                                (*badgers)[badger]->updateSimulation (1.f / 60.f);
+                            }
+                        });
+                    }
+
+                    sink = badgers->front()->getPosition().x;
+                });
+            }
+        }
+
+        // BadgerFleet::updateSimulation, each iteration steps ten thousand badgers which all turn by different amounts.
+        {
+            const auto fleet = std::make_shared<BadgerFleet>();
+
+            if (!fleet->initialise (10000))
+            {
+                throw std::runtime_error ("bench::registerCases(), unable to initialise a BadgerFleet.");
+            }
+
+            benchmark.add ("BadgerFleet::updateSimulation/10000", [=] (const unsigned long iterations)
+            {
+                fleet->reset();
+
+                for (std::size_t badger = 0; badger < fleet->getCount(); ++badger)
+                {
+                    fleet->setSpeedRate (badger, 1.f);
+                    fleet->setTurnRate (badger, std::sin (static_cast<float> (badger)));
+                }
+
+                for (unsigned long i = 0; i < iterations; ++i)
+                {
+                    fleet->updateSimulation (1.f / 60.f);
+                }
+
+                sink = fleet->getPosition (0).x;
+            });
+        }
+
+        // BadgerFleet::updateSimulation with avoidance, the grid is rebuilt and every badger queries its neighbours each iteration.
+        {
+            const auto fleet = std::make_shared<BadgerFleet>();
+
+            if (!fleet->initialise (10000))
+            {
+                throw std::runtime_error ("bench::registerCases(), unable to initialise a BadgerFleet.");
+            }
+
+            fleet->setAvoidanceRadius (60.f);
+
+            benchmark.add ("BadgerFleet::updateSimulation/10000/Avoidance", [=] (const unsigned long iterations)
+            {
+                fleet->reset();
+
+                for (std::size_t badger = 0; badger < fleet->getCount(); ++badger)
+                {
+                    fleet->setSpeedRate (badger, 1.f);
+                    fleet->setTurnRate (badger, std::sin (static_cast<float> (badger)));
+                }
+
+                for (unsigned long i = 0; i < iterations; ++i)
+                {
+                    fleet->updateSimulation (1.f / 60.f);
+                }
+
+                sink = fleet->getPosition (0).x + static_cast<float> (fleet->countOverlaps (10.f));
+            });
+        }
+
+        // PursuitDrivers::update, ten thousand drivers share one path and steer their badgers each iteration.
+        {
+            const auto generated = std::make_shared<GeneratedPath> (100);
+            const auto fleet = std::make_shared<BadgerFleet>();
+            const auto drivers = std::make_shared<PursuitDrivers>();
+
+            const auto placed = std::make_shared<StateBuffer>();
+
+            if (!fleet->initialise (10000))
+            {
+                throw std::runtime_error ("bench::registerCases(), unable to initialise a BadgerFleet.");
+            }
+
+            if (!drivers->initialise (fleet->getCount(), std::make_shared<PathSamples> (generated->getPath())))
+            {
+                throw std::runtime_error ("bench::registerCases(), unable to initialise the PursuitDrivers.");
+            }
+
+            // Placing checks every badger against the whole path, so it's done once here and each batch restores the placed state instead.
+            drivers->place (*fleet);
+            fleet->saveState (*placed);
+            drivers->saveState (*placed);
+
+            benchmark.add ("PursuitDrivers::update/10000", [=] (const unsigned long iterations)
+            {
+                placed->rewind();
+                fleet->restoreState (*placed);
+                drivers->restoreState (*placed);
+
+                for (unsigned long i = 0; i < iterations; ++i)
+                {
+                    drivers->update (*fleet);
+                    fleet->updateSimulation (1.f / 60.f);
+                }
+
+                sink = drivers->getProgress (0);
+            });
+        }
+
+        // TweenSystem::updateAll against the scalar version, every easing is used and the tweens are far too slow to ever finish.
+        for (const bool vectorised : { false, true })
+        {
+            const auto          tweens  = std::make_shared<TweenSystem>();
+            TweenSystem::Handle first   {  };
+
+            for (unsigned int i = 0; i < 10000; ++i)
+            {
+                const auto tween = tweens->create (-1000.f, 1000.f, 0.f, 0.01f, static_cast<TweenSystem::Easing> (i % 6));
+                tweens->setTarget (tween, i % 2 == 0 ? 1000.f : -1000.f);
+
+                if (i == 0)
+                {
+                    first = tween;
+                }
+            }
+
+            benchmark.add (std::string ("TweenSystem::updateAll/10000/") + (vectorised ? "SIMD" : "Scalar"), [=] (const unsigned long iterations)
+            {
+                for (unsigned long i = 0; i < iterations; ++i)
+                {
+                    if (vectorised)
+                    {
+                        tweens->updateAll (1.f / 60.f);
+                    }
+
+                    else
+                    {
+                        tweens->updateAllScalar (1.f / 60.f);
+                    }
+                }
+
+                sink = tweens->getCurrent (first);
+            });
+        }
+
+        // kernel::integrateSpeeds against the scalar version, every badger is braking or accelerating so no lane is skipped.
+        for (const bool vectorised : { false, true })
+        {
+            const auto speeds = std::make_shared<std::vector<float>> (10000, 0.f);
+            const auto maxSpeeds = std::make_shared<std::vector<float>> (10000, 80.f);
+            const auto targets = std::make_shared<std::vector<float>> (10000, 0.f);
+            const auto flipped = std::make_shared<std::vector<float>> (10000, 0.f);
+
+            for (std::size_t i = 0; i < targets->size(); ++i)
+            {
+                (*targets)[i] = std::sin (static_cast<float> (i));
+                (*flipped)[i] = -(*targets)[i];
+            }
+
+            benchmark.add (std::string ("kernel::integrateSpeeds/10000/") + (vectorised ? "SIMD" : "Scalar"), [=] (const unsigned long iterations)
+            {
+                kernel::SpeedInput input {  };
+                input.speeds = speeds->data();
+                input.maxSpeeds = maxSpeeds->data();
+                input.count = speeds->size();
+                input.acceleration = 15.f;
+                input.brakePower = 100.f;
+
+                for (unsigned long i = 0; i < iterations; ++i)
+                {
+                    // Alternate between opposite targets so the speeds keep changing direction.
+                    input.targets = (i & 1) ? flipped->data() : targets->data();
+
+                    if (vectorised)
+                    {
+                        kernel::integrateSpeeds (input, 1.f / 60.f);
+                    }
+
+                    else
+                    {
+                        kernel::integrateSpeedsScalar (input, 1.f / 60.f);
+                    }
+                }
+
+                sink = speeds->front();
+            });
+        }
+
+        // BadgerFleet::interpolate, each iteration writes the nodes of a thousand badgers.
+        {
+            const auto fleet = std::make_shared<BadgerFleet>();
+
+            if (!fleet->initialise (1000, nullptr, root, "BenchFleet"))
+            {
+                throw std::runtime_error ("bench::registerCases(), unable to initialise a BadgerFleet with nodes.");
+            }
+
+            benchmark.add ("BadgerFleet::interpolate/1000", [=] (const unsigned long iterations)
+            {
+                for (unsigned long i = 0; i < iterations; ++i)
+                {
+                    fleet->interpolate (sweep (i));
+                }
+
+                sink = fleet->getHeading (0);
+            });
+        }
+
+        // BadgerFleet::interpolate followed by the scene graph update, with the part hierarchy kept and flattened.
+        for (const bool flatten : { false, true })
+        {
+            const auto name     = std::string (flatten ? "Flat" : "Hierarchy");
+            const auto parent   = root->createChildSceneNode ("BenchFleet-" + name);
+            const auto fleet    = std::make_shared<BadgerFleet>();
+
+            if (!fleet->initialise (1000, nullptr, parent, "BenchFleet-" + name, flatten))
+            {
+                throw std::runtime_error ("bench::registerCases(), unable to initialise a BadgerFleet with nodes.");
+            }
+
+            benchmark.add ("BadgerFleet::updateNodes/1000/" + name, [=] (const unsigned long iterations)
+            {
+                for (unsigned long i = 0; i < iterations; ++i)
+                {
+                    fleet->interpolate (sweep (i));
+                    parent->_update (true, false);
+                }
+
+                sink = fleet->getHeading (0);
+            });
+        }
+
+        // util::rotationMatrix with both overloads.
+        benchmark.add ("util::rotationMatrix/Vector3", [] (const unsigned long iterations)
+        {
+            float total { 0.f };
+
+            for (unsigned long i = 0; i < iterations; ++i)
+            {
+                const float angle { sweep (i) * 360.f };
+                total += util::rotationMatrix (Ogre::Vector3 (angle, angle * 0.5f, angle * 0.25f))[0][0];
+            }
+
+            sink = total;
+        });
+
+        benchmark.add ("util::rotationMatrix/Angles", [] (const unsigned long iterations)
+        {
+            float total { 0.f };
+
+            for (unsigned long i = 0; i < iterations; ++i)
+            {
+                const float angle { sweep (i) * 360.f };
+                total += util::rotationMatrix (angle, angle * 0.5f, angle * 0.25f)[0][0];
+            }
+
+            sink = total;
+        });
+    }
+}
\ No newline at end of file
@@ -0,0 +1,19 @@
+#pragma once
+
+#ifndef _BENCHMARK_CASES_
+#define _BENCHMARK_CASES_
+
+
+// Forward declarations.
+class Benchmark;
+
+
+namespace bench
+{
+    /// <summary> Registers the Segment, Path, Badger and maths cases. Generated path files are written to the working directory when first needed. </summary>
+    /// <param name="benchmark"> The harness to add each case to. </param>
+    /// <param name="root"> The SceneNode which headless actors are attached to. </param>
+    void registerCases (Benchmark& benchmark, Ogre::SceneNode* const root);
+}
+
+#endif // _BENCHMARK_CASES_
\ No newline at end of file
@@ -1,4 +1,5 @@
 #include "Camera.h"
+#include <Input/BufferedInput.h>
 
 
 Camera::Camera (const std::shared_ptr<Ogre::SceneNode>& sceneNode, const std::shared_ptr<Ogre::MovableObject>& camera) : m_sceneNode (sceneNode), m_camera (camera)
@@ -6,7 +7,7 @@ Camera::Camera (const std::shared_ptr<Ogre::SceneNode>& sceneNode, const std::sh
 }
 
 
-void Camera::Update(OIS::Keyboard* keyboard, OIS::Mouse* mouse)
+void Camera::Update(const BufferedInput& input)
 {
 	Ogre::Vector3 currentPosition = m_sceneNode->getPosition();
 	Ogre::Quaternion currentRotation = m_sceneNode->getOrientation();
@@ -23,19 +24,19 @@ void Camera::Update(OIS::Keyboard* keyboard, OIS::Mouse* mouse)
 	float sideScale = 0.0f;
 	float verticalScale = 0.0f;
 
-	if (keyboard->isKeyDown(OIS::KC_W))
+	if (input.isKeyDown(OIS::KC_W))
 		forwardScale = 1.0f;
-	else if (keyboard->isKeyDown(OIS::KC_S))
+	else if (input.isKeyDown(OIS::KC_S))
 		forwardScale = -1.0f;
 
-	if (keyboard->isKeyDown(OIS::KC_D))
+	if (input.isKeyDown(OIS::KC_D))
 		sideScale = -1.0f;
-	else if (keyboard->isKeyDown(OIS::KC_A))
+	else if (input.isKeyDown(OIS::KC_A))
 		sideScale = 1.0f;
 
-	if (keyboard->isKeyDown(OIS::KC_Q) || keyboard->isKeyDown(OIS::KC_HOME))
+	if (input.isKeyDown(OIS::KC_Q) || input.isKeyDown(OIS::KC_HOME))
 		verticalScale = 1.0f;
-	else if (keyboard->isKeyDown(OIS::KC_Z) || keyboard->isKeyDown(OIS::KC_END))
+	else if (input.isKeyDown(OIS::KC_Z) || input.isKeyDown(OIS::KC_END))
 		verticalScale = -1.0f;
 
 	currentPosition += (look * forwardScale);
@@ -45,14 +46,17 @@ void Camera::Update(OIS::Keyboard* keyboard, OIS::Mouse* mouse)
 	m_sceneNode->setPosition(currentPosition);
 	std::static_pointer_cast<Ogre::Camera>(m_camera)->lookAt(currentPosition + look);
 
-	if (mouse->getMouseState().X.abs > mouse->getMouseState().width)
+	const OIS::MouseState& mouseState = input.getMouseState();
+
+	if (mouseState.X.abs > mouseState.width)
 		return;
 
-	if (mouse->getMouseState().Y.abs > mouse->getMouseState().height)
+	if (mouseState.Y.abs > mouseState.height)
 		return;
 
-	const int mouseX = mouse->getMouseState().X.rel;
-	const int mouseY = mouse->getMouseState().Y.rel;
+	//Every movement event since the last frame is accumulated for us
+	const int mouseX = input.getMouseX();
+	const int mouseY = input.getMouseY();
 
 	m_rotation.x += mouseX;
 	m_rotation.y += mouseY;
@@ -8,13 +8,16 @@
 #include <memory>
 
 
+// Forward declarations.
+class BufferedInput;
+
 class Camera
 {
     public:
 	    Camera (const std::shared_ptr<Ogre::SceneNode>& sceneNode, const std::shared_ptr<Ogre::MovableObject>& camera);
 	    ~Camera() = default;
 
-	    void Update(OIS::Keyboard* keyboard, OIS::Mouse* mouse);
+	    void Update(const BufferedInput& input);
 
     private:
 
@@ -1,15 +1,30 @@
 #include "OgreApplication.h"
 #include <Framework/Camera.h>
+#include <Input/BufferedInput.h>
+#include <Misc/Profiler.h>
+#include <Rendering/NullRenderer.h>
 #include <Simulation/Simulation.h>
+#include <Simulation/SimulationThread.h>
+#include <Utility/Maths.h>
+#include <cmath>
+#include <iomanip>
 #include <iostream>
+#include <sstream>
 
-static double STEP_LENGTH = 0.03;
+static double DEFAULT_STEP_RATE = 60.0;
+static unsigned int MAX_STEPS_PER_FRAME = 60;
+static double MIN_TIME_SCALE = 0.01;
+static double MAX_TIME_SCALE = 1000.0;
 
 using namespace std;
 
 OgreApplication::OgreApplication(void):root(nullptr), renderWindow( nullptr), sceneManager ( nullptr), rootSceneNode ( nullptr), viewport( nullptr),
-	inputManager( nullptr), mouse( nullptr), keyboard( nullptr), timer( nullptr)
+	inputManager( nullptr), mouse( nullptr), keyboard( nullptr), timer( nullptr), stepLength(1.0 / DEFAULT_STEP_RATE),
+	threadedSimulation(true), showFrameMetrics(false), frameLimit(0), fleetSize(0), fleetInstanced(false), timeScale(1.0), stepBudget(0.0), renderInterval(1),
+	simulatedTime(0.0), realTime(0.0)
 {
+	//Every possible number of steps per frame gets its own bucket so fast-forwarding never overflows the histogram
+	frameMetrics.setMaxSubSteps(static_cast<unsigned int>(MAX_STEPS_PER_FRAME * MAX_TIME_SCALE));
 }
 
 
@@ -49,11 +64,28 @@ void OgreApplication::RunOgreApplication()
 	auto simulation = make_shared<Simulation>();
 	simulation->initialise (this);
 
-	unsigned long lastTime = timer->getMilliseconds();
-	unsigned long deltaTime = 0;
+	//Fast-forwarding needs proportionally more steps each frame, the budget stops them taking over the frame
+	const unsigned int maxStepsPerFrame = static_cast<unsigned int>(std::ceil(MAX_STEPS_PER_FRAME * util::max(timeScale, 1.0)));
+	const unsigned long stepBudgetMicroseconds = static_cast<unsigned long>(stepBudget * 1000000.0);
+
+	//Optionally step the simulation on its own thread, we then only apply the transforms it publishes
+	unique_ptr<SimulationThread> simulationThread;
+
+	if (threadedSimulation)
+	{
+		simulation->interpolate (1.0f);
+		simulationThread = make_unique<SimulationThread>(*simulation, stepLength);
+		simulationThread->setTimeScale(timeScale);
+		simulationThread->setStepBudget(stepBudget);
+		simulationThread->setMaxStepsPerTick(maxStepsPerFrame);
+		simulationThread->start();
+	}
+
 	float deltaTime_s = 0.0f;
 
 	this->GetOgreWrapper().GetRoot()->clearEventTimes();
+	framePacer.start();
+	framePacer.resetStatistics();
 
 	double timeToUpdate = 0.0;
     unsigned int index = 0;
@@ -61,81 +93,211 @@ void OgreApplication::RunOgreApplication()
 
 
 	bool animationState = false;
-	//Game loop
-	while (!this->GetOgreWrapper().GetWindow()->isClosed())
+	unsigned long previousStepCount = 0;
+	unsigned long previousStepTime = 0;
+	simulatedTime = 0.0;
+	realTime = 0.0;
+
+	frameMetrics.openCSV("frame_metrics.csv");
+	PROFILE_THREAD_NAME("Main");
+	//Game loop, headless applications have no window to close so rely on the frame limit instead
+	for (unsigned long frame = 0; frameLimit == 0 || frame < frameLimit; ++frame)
 	{
-
-		//Evaluate the current time and the time elapsed since last frame 
-		//Prepare the next iteration. 	
-		unsigned long currentTime = timer->getMilliseconds();
-		deltaTime = currentTime - lastTime;
-		if(deltaTime == 0)  continue;
-
-		lastTime = currentTime;
-		deltaTime_s = 0.001f * float(deltaTime);
-
-		keyboard->capture();
-		mouse->capture();
-		camera->Update(keyboard.get(), mouse.get());
-
-		float coeff = 200.0f * deltaTime_s;
-		Ogre::Vector3 translation(Ogre::Vector3::ZERO);
-
-		if (keyboard->isKeyDown(OIS::KC_ESCAPE))
+		if (renderWindow && renderWindow->isClosed())
 		{
 			break;
 		}
-		else if (keyboard->isKeyDown(OIS::KC_V)){
-			auto camera = static_cast<Ogre::Camera*>(cameraNode->getAttachedObject("MainCamera"));
-			camera->setPolygonMode(Ogre::PM_WIREFRAME);
-		}
-		else if (keyboard->isKeyDown(OIS::KC_B))
-		{
-			auto camera = static_cast<Ogre::Camera*>(cameraNode->getAttachedObject("MainCamera"));
-			camera->setPolygonMode(Ogre::PM_POINTS);
-		}
-		else if (keyboard->isKeyDown(OIS::KC_N))
-		{
-			auto camera = static_cast<Ogre::Camera*>(cameraNode->getAttachedObject("MainCamera"));
-			camera->setPolygonMode(Ogre::PM_SOLID);
-		}
-		if (keyboard->isKeyDown(OIS::KC_R))
+
+		//Evaluate the time elapsed since last frame with microsecond precision.
+		//The pacer sleeps away any unused budget rather than spinning on the timer.
+		deltaTime_s = static_cast<float>(framePacer.beginFrame());
+
+		//There is no input without a window
+		if (keyboard)
 		{
-			simulation->reset();
+			//Capturing delivers every event since the last frame to the listeners, nothing else queries the devices
+			input->beginFrame();
+			keyboard->capture();
+			mouse->capture();
+			camera->Update(*input);
+
+			float coeff = 200.0f * deltaTime_s;
+			Ogre::Vector3 translation(Ogre::Vector3::ZERO);
+
+			if (input->isKeyDown(OIS::KC_ESCAPE))
+			{
+				break;
+			}
+			else if (input->isKeyDown(OIS::KC_V)){
+				auto camera = static_cast<Ogre::Camera*>(cameraNode->getAttachedObject("MainCamera"));
+				camera->setPolygonMode(Ogre::PM_WIREFRAME);
+			}
+			else if (input->isKeyDown(OIS::KC_B))
+			{
+				auto camera = static_cast<Ogre::Camera*>(cameraNode->getAttachedObject("MainCamera"));
+				camera->setPolygonMode(Ogre::PM_POINTS);
+			}
+			else if (input->isKeyDown(OIS::KC_N))
+			{
+				auto camera = static_cast<Ogre::Camera*>(cameraNode->getAttachedObject("MainCamera"));
+				camera->setPolygonMode(Ogre::PM_SOLID);
+			}
+			if (input->isKeyDown(OIS::KC_R))
+			{
+				if (simulationThread)
+				{
+					simulationThread->requestReset();
+				}
+				else
+				{
+					simulation->reset();
+				}
+			}
+
+			//Write a trace of every profiled scope so far when F12 is pressed, only once per press
+			if (input->wasPressed(OIS::KC_F12))
+			{
+				PROFILE_DUMP("trace.json");
+			}
+
+			//Toggle the frame metrics overlay with F3
+			if (input->wasPressed(OIS::KC_F3))
+			{
+				showFrameMetrics = !showFrameMetrics;
+				UpdateMetricsOverlay();
+			}
 		}
-		
-		
-		const OIS::MouseState& mouseState = mouse->getMouseState();
 
+		// The simulation may be on another thread so it can only use input we've sampled here.
+		simulation->captureInput();
 		
-		elapsedTime += deltaTime;
+		
+		elapsedTime += deltaTime_s * 1000.0f;
 		
 		if (elapsedTime > 100)
 		{
-			// do something
+			// Refresh the percentiles ten times a second, any faster would be unreadable.
+			if (showFrameMetrics)
+			{
+				UpdateMetricsOverlay();
+			}
 
 			elapsedTime = 0;
 		}
 
-		timeToUpdate += deltaTime_s;
+		const unsigned long simulationStart = frameMetrics.now();
 		unsigned int numOfUpdates = 0;
+		double simulationTime_ms = 0.0;
+
+		//Decimated frames still simulate and pump messages but nothing is presented
+		const bool present = frame % renderInterval == 0;
 
-		while (timeToUpdate > STEP_LENGTH && numOfUpdates < 60)
+		if (simulationThread)
+		{
+			// Display whatever the simulation thread published most recently.
+			if (present)
+			{
+				simulationThread->apply();
+			}
+
+			// Report how many steps the other thread completed during this frame and how long it spent on them, applying isn't simulating.
+			const unsigned long stepCount = simulationThread->getStepCount();
+			numOfUpdates = static_cast<unsigned int>(stepCount - previousStepCount);
+			previousStepCount = stepCount;
+
+			const unsigned long stepTime = simulationThread->getStepTime();
+			simulationTime_ms = (stepTime - previousStepTime) / 1000.0;
+			previousStepTime = stepTime;
+		}
+		else
 		{
-			timeToUpdate -= STEP_LENGTH;
-			simulation->update (deltaTime_s);
-			//simulation->Update(STEP_LENGTH);
-			numOfUpdates++;
+			timeToUpdate += deltaTime_s * timeScale;
+
+			// Always step by a fixed amount so simulated time matches scaled real time regardless of the frame rate.
+			while (timeToUpdate >= stepLength && numOfUpdates < maxStepsPerFrame)
+			{
+				if (stepBudgetMicroseconds != 0 && frameMetrics.now() - simulationStart >= stepBudgetMicroseconds)
+				{
+					break;
+				}
+
+				timeToUpdate -= stepLength;
+				simulation->update (static_cast<float> (stepLength));
+				numOfUpdates++;
+			}
+
+			// If we've fallen too far behind drop the backlog instead of spiralling, the simulation will slow down instead.
+			if (timeToUpdate >= stepLength)
+			{
+				timeToUpdate = std::fmod (timeToUpdate, stepLength);
+			}
+
+			// Render each actor between the last two steps using the time left over in the accumulator.
+			if (present)
+			{
+				simulation->interpolate (static_cast<float> (timeToUpdate / stepLength));
+			}
+
+			simulationTime_ms = (frameMetrics.now() - simulationStart) / 1000.0;
 		}
+
+		simulatedTime += numOfUpdates * stepLength;
+		realTime += deltaTime_s;
 		
 		// Update window false
 		bool updateWin = false;
 		bool verticalSynchro = true;
-		this->Run(updateWin, verticalSynchro);
+		const unsigned long renderStart = frameMetrics.now();
+		if (present)
+		{
+			this->Run(updateWin, verticalSynchro);
+		}
+		const unsigned long renderEnd = frameMetrics.now();
+
+		//Timestamps wrap around so only their differences are meaningful
+		frameMetrics.addFrame(deltaTime_s * 1000.0, simulationTime_ms, (renderEnd - renderStart) / 1000.0, numOfUpdates);
 
 		Ogre::WindowEventUtilities::messagePump();
 	}
 
+	//The simulation thread must finish before the scene is cleaned up
+	if (simulationThread)
+	{
+		simulationThread->stop();
+		std::cout << "Simulation steps: " << simulationThread->getStepCount() << std::endl;
+	}
+
+	std::cout << "Frames: " << framePacer.getFrameCount()
+	          << ", average: " << framePacer.getAverageFrameTime() * 1000.0 << "ms"
+	          << ", min: " << framePacer.getMinFrameTime() * 1000.0 << "ms"
+	          << ", max: " << framePacer.getMaxFrameTime() * 1000.0 << "ms"
+	          << ", idle: " << framePacer.getIdleTime() << "s" << std::endl;
+
+	std::cout << "Time scale: " << timeScale << "x, achieved: " << GetSpeedUp() << "x"
+	          << " (" << simulatedTime << "s simulated in " << realTime << "s)" << std::endl;
+
+	frameMetrics.closeCSV();
+	std::cout << frameMetrics.summary() << std::endl;
+
+	//Instancing should keep this flat however large the fleet is
+	if (renderWindow)
+	{
+		const Ogre::RenderTarget::FrameStats& stats = renderWindow->getStatistics();
+		std::cout << "Last frame: " << stats.batchCount << " batches, " << stats.triangleCount << " triangles" << std::endl;
+	}
+
+	if (nullRenderer)
+	{
+		const DrawStatistics& total = nullRenderer->getTotal();
+		std::cout << "Null renderer: " << nullRenderer->getFrameCount() << " frames"
+		          << ", submissions: " << total.submissions
+		          << ", triangles: " << total.triangles
+		          << ", visible objects: " << total.visibleObjects
+		          << ", culled objects: " << total.culledObjects << std::endl;
+	}
+
+	PROFILE_DUMP("trace.json");
+
 	this->CleanUp();
 
 	return;
@@ -143,10 +305,14 @@ void OgreApplication::RunOgreApplication()
 
 void OgreApplication::CleanUp()
 {
-  renderWindow->removeAllViewports();
+  if (renderWindow)
+    renderWindow->removeAllViewports();
+  if (nullRenderer)
+    nullRenderer->destroyAllDrawables();
   sceneManager ->destroyAllLights();
   sceneManager ->destroyAllManualObjects();
   sceneManager ->destroyAllEntities();
+  resourceCache.clear();
 }
 
 //\ brief Setup and initialize
@@ -165,8 +331,16 @@ bool OgreApplication::Initialize()
 	sceneManager  = root->createSceneManager(Ogre::ST_GENERIC, "MySceneManager");
 	rootSceneNode  = sceneManager ->getRootSceneNode();
 
-	// load resources
-	Ogre::ResourceGroupManager::getSingleton().initialiseAllResourceGroups();
+	if (ogreWrapper.IsHeadless())
+	{
+		// Materials can't be compiled without a render system so scripts aren't parsed, meshes are still found in the resource locations.
+		nullRenderer.reset(new NullRenderer(sceneManager));
+	}
+	else
+	{
+		// load resources
+		Ogre::ResourceGroupManager::getSingleton().initialiseAllResourceGroups();
+	}
 
 	return true;
 }
@@ -184,33 +358,44 @@ shared_ptr<Ogre::SceneNode>  OgreApplication::CreateCamera(Ogre::String  name)
 	cameraNode.reset(rootSceneNode ->createChildSceneNode(name.append("Node")));
 	cameraNode->attachObject(camera);
 
-	// Setup viewport parameters 
-	// Add viewport to the window with the camera 
-	float viewportWidth = 1.0f;
-	float viewportHeight = 1.0f;
-	float viewportLeft	= (1.0f - viewportWidth) * 0.5f;
-	float viewportTop = (1.0f - viewportHeight) * 0.5f;
-	unsigned short viewportZOrder = 100;
-	
-	viewport = renderWindow->addViewport(camera, viewportZOrder, viewportLeft, viewportTop, viewportWidth, viewportHeight);
+	// Headless applications have no viewport so cull as if rendering to the default window.
+	float ratio = 1280.0f / 720.0f;
+
+	if (!renderWindow)
+	{
+		nullRenderer->setCamera(camera);
+	}
+	else
+	{
+		// Setup viewport parameters 
+		// Add viewport to the window with the camera 
+		float viewportWidth = 1.0f;
+		float viewportHeight = 1.0f;
+		float viewportLeft	= (1.0f - viewportWidth) * 0.5f;
+		float viewportTop = (1.0f - viewportHeight) * 0.5f;
+		unsigned short viewportZOrder = 100;
 
-	// Set the viewport to draw the scene automatically
-	// whenever the window is updated.
-	viewport->setAutoUpdated(true);
+		viewport = renderWindow->addViewport(camera, viewportZOrder, viewportLeft, viewportTop, viewportWidth, viewportHeight);
 
-	viewport->setBackgroundColour(Ogre::ColourValue(0.2f, 0.2f, 0.3f));
+		// Set the viewport to draw the scene automatically
+		// whenever the window is updated.
+		viewport->setAutoUpdated(true);
+
+		viewport->setBackgroundColour(Ogre::ColourValue(0.2f, 0.2f, 0.3f));
+
+		// Setup the visual ratio of the camera. To make it looks real, same as the viewport.
+		ratio = static_cast<float>(viewport->getActualWidth()) / static_cast<float>(viewport->getActualHeight());
+
+		// Set the window to be active
+		renderWindow->setActive(true);
+
+		// Update the content of the window not automatically.
+		renderWindow->setAutoUpdated(false);
+	}
 
-	// Setup the visual ratio of the camera. To make it looks real, same as the viewport.
-	float ratio = static_cast<float>(viewport->getActualWidth()) / static_cast<float>(viewport->getActualHeight());
 	camera->setAspectRatio(ratio);
 	camera->setNearClipDistance(0.2f);
 	camera->setFarClipDistance(1000.0f);
-	
-	// Set the window to be active
-	renderWindow->setActive(true);
-
-	// Update the content of the window not automatically.
-	renderWindow->setAutoUpdated(false);
 
 	root->clearEventTimes();
 
@@ -291,13 +476,13 @@ Ogre::SceneNode* OgreApplication::CreateEntityFromMesh(std::string mesh, std::st
 	// add the second object
 	Ogre::String meshName = mesh.substr(0, mesh.find(".mesh"));
 
+	// Check for the first entity rather than catching an exception, clones are the common case.
 	Ogre::Entity* meshEntity = nullptr;
-	try
+	if (sceneManager->hasEntity(meshName))
 	{
-		meshEntity = sceneManager->getEntity(meshName);
-		meshEntity = meshEntity->clone(meshName + "-" + name);
+		meshEntity = sceneManager->getEntity(meshName)->clone(meshName + "-" + name);
 	}
-	catch (Ogre::ItemIdentityException ex)
+	else
 	{
 		try
 		{
@@ -385,11 +570,23 @@ void OgreApplication::CreateEnviroment()
 	Ogre::MeshManager::getSingleton().createPlane("ground", Ogre::ResourceGroupManager::DEFAULT_RESOURCE_GROUP_NAME, plane, 400, 400, 200, 200, true, 5, 5, 5, Ogre::Vector3::UNIT_Z);
 
 	Ogre::String tempName = "Ground";
-	Ogre::Entity* ground = this->sceneManager->createEntity("Ground", "ground");
-	ground->setCastShadows(false);
+	Ogre::Entity* ground = nullptr;
+	Ogre::MovableObject* groundObject = nullptr;
+
+	// Headless applications only record that the ground would be drawn.
+	if (nullRenderer)
+	{
+		groundObject = nullRenderer->createDrawable("ground", "GroundTexture");
+	}
+	else
+	{
+		ground = this->sceneManager->createEntity("Ground", "ground");
+		ground->setCastShadows(false);
+		groundObject = ground;
+	}
 
 	Ogre::SceneNode* groundNode = this->sceneManager->getRootSceneNode()->createChildSceneNode(tempName.append("Node"));
-	groundNode->attachObject(ground);
+	groundNode->attachObject(groundObject);
 	groundNode->setPosition(0.0f, 0.0f, 0.0f);
 
 	Ogre::MaterialPtr material = Ogre::MaterialManager::getSingleton().create("GroundTexture", Ogre::ResourceGroupManager::DEFAULT_RESOURCE_GROUP_NAME);
@@ -401,7 +598,10 @@ void OgreApplication::CreateEnviroment()
 	textureUnit->setTextureCoordSet(0);
 
 	const Ogre::String& materialName = "GroundTexture";
-	ground->setMaterialName(materialName);
+	if (ground)
+	{
+		ground->setMaterialName(materialName);
+	}
 	
 
 }
@@ -409,6 +609,15 @@ void OgreApplication::CreateEnviroment()
 
 void OgreApplication::Run(bool updateOption, bool synchroOption)
 {
+	PROFILE_SCOPE("OgreApplication::Run");
+
+	// The null backend only updates and culls the scene.
+	if (nullRenderer)
+	{
+		nullRenderer->renderOneFrame();
+		return;
+	}
+
 	renderWindow->update(updateOption);
     renderWindow->swapBuffers();
     root->renderOneFrame();
@@ -416,6 +625,11 @@ void OgreApplication::Run(bool updateOption, bool synchroOption)
 
 void OgreApplication::CreateIOS()
 {
+	// OIS reads input through a window, headless applications have none.
+	if (!renderWindow)
+	{
+		return;
+	}
 
 	//The input/output system needs an handle to a window as input, in a string format. 
 	//1/ Create a size_t object that we need to use to retrieve a window handle from our render window 
@@ -438,14 +652,18 @@ void OgreApplication::CreateIOS()
 	//4/ we create the input/output system itself.
 	inputManager = OIS::InputManager::createInputSystem( lSpecialParameters );
 	
-	//the events can be stored or not in a buffer 
-	bool lBufferedKeys = false;
-	bool lBufferedMouse = false;
+	//the events can be stored or not in a buffer, buffered events are delivered to listeners so short taps aren't missed between frames
+	bool lBufferedKeys = true;
+	bool lBufferedMouse = true;
 
 	//creation of the keyboard-representing object 
 	keyboard.reset(static_cast<OIS::Keyboard*>(inputManager->createInputObject(OIS::OISKeyboard, lBufferedKeys)));
 	//creation of the mouse-representing object 
 	mouse.reset(static_cast<OIS::Mouse*>(inputManager->createInputObject( OIS::OISMouse, lBufferedMouse)));
+	//every event is passed on to the main loop and any simulator which subscribes
+	input.reset(new BufferedInput());
+	keyboard->setEventCallback(input.get());
+	mouse->setEventCallback(input.get());
 	//then must tell the mouse how much it is allowed to move. 
 	unsigned int width, height, colourDepth;
     int top, left;
@@ -456,6 +674,53 @@ void OgreApplication::CreateIOS()
 	
 }
 
+void OgreApplication::SetTargetFrameRate(double framesPerSecond)
+{
+	framePacer.setTargetFrameRate(framesPerSecond);
+}
+
+void OgreApplication::UpdateMetricsOverlay()
+{
+	// Headless applications print the summary on exit instead.
+	if (!renderWindow)
+	{
+		return;
+	}
+
+	//There are no fonts to draw with so the window title doubles as the overlay
+	std::ostringstream title;
+	title << renderWindow->getName();
+
+	if (showFrameMetrics)
+	{
+		title << " - " << frameMetrics.summary() << " | Speed " << std::fixed << std::setprecision(1) << GetSpeedUp() << "x";
+	}
+
+#if defined(_WIN32)
+	HWND windowHandle = nullptr;
+	renderWindow->getCustomAttribute("WINDOW", &windowHandle);
+
+	if (windowHandle)
+	{
+		SetWindowTextA(windowHandle, title.str().c_str());
+	}
+#endif
+}
+
+void OgreApplication::SetTimeScale(double scale)
+{
+	timeScale = util::clamp(scale, MIN_TIME_SCALE, MAX_TIME_SCALE);
+}
+
+void OgreApplication::SetSimulationRate(double stepsPerSecond)
+{
+	// Silently ignore invalid rates.
+	if (stepsPerSecond > 0.0)
+	{
+		stepLength = 1.0 / stepsPerSecond;
+	}
+}
+
 shared_ptr<Ogre::Timer> OgreApplication::CreateTimer()
 {
 	timer = make_shared<Ogre::Timer>(*root->getTimer());
@@ -5,9 +5,15 @@
 
 
 #include <Framework/OgreWrapper.h>
+#include <Misc/FrameMetrics.h>
+#include <Misc/FramePacer.h>
+#include <Rendering/ResourceCache.h>
 
 using namespace std;
 
+class BufferedInput;
+class NullRenderer;
+
 struct SceneNodeAndName
 {
 	Ogre::String Name;
@@ -27,13 +33,31 @@ private:
 	Ogre::SceneNode	 *rootSceneNode;				
 	Ogre::Viewport	*viewport;	
 	shared_ptr<Ogre::Timer>	timer;
+	double	stepLength; //! The fixed simulation step in seconds.
+	bool	threadedSimulation; //! Whether the simulation is stepped on its own thread whilst this thread renders.
+	FramePacer	framePacer; //! Measures frame times and limits the frame rate without busy waiting.
+	FrameMetrics	frameMetrics; //! Rolling percentiles of frame, simulation and render times.
+	bool	showFrameMetrics; //! Whether the frame metrics are displayed in the window title.
+	std::unique_ptr<NullRenderer>	nullRenderer; //! Records draw submissions in place of rendering when the null backend is used.
+	ResourceCache	resourceCache; //! The meshes and materials used by util::createEntity(), released by CleanUp().
+	unsigned long	frameLimit; //! How many frames to run before exiting, 0 runs until the window is closed.
+	std::string	pathFile; //! The XML file the path simulator loads, empty asks on the console.
+	unsigned int	fleetSize; //! How many badgers the fleet simulator drives, 0 leaves it out of the simulation.
+	bool	fleetInstanced; //! Whether the fleet is drawn with hardware instancing rather than an entity per part.
+	double	timeScale; //! How many seconds are simulated per real second, e.g. 1 to 1000.
+	double	stepBudget; //! The most time in seconds spent on simulation steps each frame, 0 means only the step cap applies.
+	unsigned int	renderInterval; //! Only every nth frame is rendered so the simulation can run many steps between presented frames.
+	double	simulatedTime; //! The total seconds simulated whilst running.
+	double	realTime; //! The total seconds of frame time whilst running.
 
 	OIS::InputManager *inputManager;				
 	std::shared_ptr<OIS::Mouse>	mouse;						
 	std::shared_ptr<OIS::Keyboard> keyboard;					
+	std::unique_ptr<BufferedInput> input; //! Receives the buffered events of the keyboard and mouse.
 																	
 	void	CreateLights();													
 	void	CreateEnviroment();
+	void	UpdateMetricsOverlay();
 	   
 public:
 																
@@ -61,6 +85,61 @@ public:
 	void DestroyNode(Ogre::SceneNode *nodeName);
 
 	shared_ptr<Ogre::Timer> CreateTimer();
+
+	//! Limits the frame rate by sleeping away unused frame time. 0 removes the limit.
+	void SetTargetFrameRate(double framesPerSecond);
+	const FramePacer& GetFramePacer() const { return framePacer; }
+
+	//! Shows the frame time percentiles in the window title, F3 toggles this whilst running.
+	void SetShowFrameMetrics(bool show) { showFrameMetrics = show; }
+	const FrameMetrics& GetFrameMetrics() const { return frameMetrics; }
+
+	//! Sets how many fixed simulation steps occur per second, e.g. 60 to 240. Invalid values are ignored.
+	void SetSimulationRate(double stepsPerSecond);
+	double GetSimulationRate() const { return 1.0 / stepLength; }
+
+	//! Selects the render backend, the null backend runs without a window or GPU. Must be set before Initialize().
+	void SetRenderBackend(RenderBackend backend) { ogreWrapper.SetRenderBackend(backend); }
+	bool IsHeadless() const { return ogreWrapper.IsHeadless(); }
+	NullRenderer* GetNullRenderer() { return nullRenderer.get(); }
+
+	//! The meshes and materials entities are created from, so each is only looked up once.
+	ResourceCache& GetResourceCache() { return resourceCache; }
+
+	//! Exits after the given number of frames, 0 removes the limit. Headless applications have no window to close so need a limit.
+	void SetFrameLimit(unsigned long frames) { frameLimit = frames; }
+	unsigned long GetFrameLimit() const { return frameLimit; }
+
+	//! Sets the XML file the path simulator loads, headless applications must be given one because nobody can be asked. Must be set before Initialize().
+	void SetPathFile(const std::string& file) { pathFile = file; }
+	const std::string& GetPathFile() const { return pathFile; }
+
+	//! Adds a fleet of badgers to the simulation, 0 leaves it out. Must be set before RunOgreApplication().
+	void SetFleetSize(unsigned int count) { fleetSize = count; }
+	unsigned int GetFleetSize() const { return fleetSize; }
+
+	//! Draws the fleet with one instance batch per part instead of an entity per part. Must be set before RunOgreApplication().
+	void SetFleetInstanced(bool instanced) { fleetInstanced = instanced; }
+	bool IsFleetInstanced() const { return fleetInstanced; }
+
+	//! Fast-forwards (or slows) the simulation, e.g. 1 to 1000. Must be set before RunOgreApplication(). Values outside the supported range are clamped.
+	void SetTimeScale(double scale);
+	double GetTimeScale() const { return timeScale; }
+
+	//! Limits how long each frame (or simulation thread tick) may spend on simulation steps, any backlog left when it runs out is dropped. 0 removes the budget.
+	void SetStepBudget(double seconds) { stepBudget = seconds > 0.0 ? seconds : 0.0; }
+	double GetStepBudget() const { return stepBudget; }
+
+	//! Only renders every nth frame, input and simulation continue on the frames in between. 0 and 1 render every frame.
+	void SetRenderInterval(unsigned int frames) { renderInterval = frames > 1 ? frames : 1; }
+	unsigned int GetRenderInterval() const { return renderInterval; }
+
+	//! The achieved ratio of simulated time to real time, this falls short of the time scale when the step budget or cap is reached.
+	double GetSpeedUp() const { return realTime > 0.0 ? simulatedTime / realTime : 0.0; }
+
+	//! Runs the simulation on its own thread so it overlaps with rendering. Must be set before RunOgreApplication().
+	void SetThreadedSimulation(bool threaded) { threadedSimulation = threaded; }
+	bool IsSimulationThreaded() const { return threadedSimulation; }
 	void CreateScene();
 	std::shared_ptr<Ogre::SceneNode> CreateEntity();
 
@@ -69,6 +148,8 @@ public:
 									
 	shared_ptr<OIS::Keyboard> GetKeyboard(){return keyboard;}
     shared_ptr<OIS::Mouse> GetMouse(){return mouse;}
+	//! The buffered events of the keyboard and mouse, a nullptr when headless. Simulators should subscribe rather than query the devices.
+	BufferedInput* GetInput(){return input.get();}
 	shared_ptr<Ogre::Timer> GetTimer(){return timer;}
 
 };
@@ -1,9 +1,12 @@
 #include "OgreWrapper.h"
 #include <OgreConfigFile.h>
+#include <OgreDefaultHardwareBufferManager.h>
 
 OgreWrapper::OgreWrapper():
 	root(NULL), 
-	window(NULL)
+	window(NULL),
+	bufferManager(NULL),
+	backend(RenderBackend::Default)
 {
 }
 
@@ -24,9 +27,18 @@ bool OgreWrapper::Initialize()
 	// STEP 2/  Load plugins & resources. At least a 'RenderSystem' plugin to drive opengl or directx.
 	std::vector<Ogre::String> plugins;	
 
-	plugins.push_back("RenderSystem_GL");
-	plugins.push_back("RenderSystem_Direct3D9");
-	plugins.push_back("Plugin_ParticleFX");
+	if (backend == RenderBackend::Null)
+	{
+		// Without a render system meshes keep their vertex and index buffers in system memory.
+		// Like the root it lives for the rest of the program as resources may still refer to it.
+		bufferManager = OGRE_NEW Ogre::DefaultHardwareBufferManager();
+	}
+	else
+	{
+		plugins.push_back("RenderSystem_GL");
+		plugins.push_back("RenderSystem_Direct3D9");
+		plugins.push_back("Plugin_ParticleFX");
+	}
 
 	for(std::vector<Ogre::String>::iterator it = plugins.begin(); it != plugins.end(); ++it)
 	{
@@ -63,6 +75,11 @@ bool OgreWrapper::Initialize()
 		}
 	}
 		
+	// The null backend has no render system to select and nothing to display.
+	if (backend == RenderBackend::Null)
+	{
+		return true;
+	}
 		
 	// STEP 3/ get the list of render drivers available	
 	const Ogre::RenderSystemList& renderSystemList = root->getAvailableRenderers();
@@ -99,5 +116,4 @@ void OgreWrapper::UnLoadResources()
 	// unload the map so we don't interfere with subsequent samples
 	Ogre::ResourceGroupManager& rgm = Ogre::ResourceGroupManager::getSingleton();
 	rgm.unloadResourceGroup(rgm.getWorldResourceGroupName());
-}
-
+}
\ No newline at end of file
@@ -7,12 +7,22 @@
 #include <memory>
 
 
+//! Selects what OgreWrapper initialises Ogre to render with.
+enum class RenderBackend
+{
+	Default,	// OpenGL or Direct3D, chosen with the config dialog, rendering to a window.
+	Null		// No render system or window, see NullRenderer. Allows the application to run headless, e.g. on CI.
+};
+
+
 /// \brief This class contains a function to initialise Ogre3d in one go.
 class OgreWrapper
 {
 private:
 	Ogre::Root *root;					
 	Ogre::RenderWindow *window;					
+	Ogre::HardwareBufferManager *bufferManager; // Only created by the null backend, meshes need somewhere to keep their buffers.
+	RenderBackend backend;
 
 private:
 	// These functions will prevent the user and the class to creates copies of the original object.
@@ -27,11 +37,15 @@ public:
 	~OgreWrapper();
 
 	bool Initialize();
+
+	//! Must be set before Initialize().
+	void SetRenderBackend(RenderBackend renderBackend) { backend = renderBackend; }
+	RenderBackend GetRenderBackend() const { return backend; }
+	bool IsHeadless() const { return backend == RenderBackend::Null; }
 									
 	Ogre::Root *GetRoot() const {return root;}					
     Ogre::RenderWindow *GetWindow() const { return window; }
 									
 };
 
-#endif
-
+#endif
\ No newline at end of file
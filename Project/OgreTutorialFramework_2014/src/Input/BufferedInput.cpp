@@ -0,0 +1,166 @@
+#include "BufferedInput.h"
+
+
+
+// STL headers.
+#include <algorithm>
+
+
+
+// Globals.
+const std::size_t keyCount { 256 };     //!< OIS key codes are scan codes so always fit in a byte.
+
+
+
+#pragma region Constructors and destructor
+
+BufferedInput::BufferedInput()
+    : m_keysDown (keyCount, false), m_keysPressed (keyCount, false)
+{
+}
+
+
+BufferedInput::~BufferedInput()
+{
+}
+
+#pragma endregion
+
+
+#pragma region Capturing thread interface
+
+bool BufferedInput::isKeyDown (const OIS::KeyCode key) const
+{
+    return static_cast<std::size_t> (key) < keyCount && m_keysDown[key];
+}
+
+
+bool BufferedInput::wasPressed (const OIS::KeyCode key) const
+{
+    return static_cast<std::size_t> (key) < keyCount && m_keysPressed[key];
+}
+
+
+void BufferedInput::beginFrame()
+{
+    std::fill (m_keysPressed.begin(), m_keysPressed.end(), false);
+
+    m_mouseX = 0;
+    m_mouseY = 0;
+}
+
+
+std::shared_ptr<InputQueue> BufferedInput::subscribe (const std::size_t capacity)
+{
+    auto queue = std::make_shared<InputQueue> (capacity);
+    m_queues.push_back (queue);
+
+    return queue;
+}
+
+#pragma endregion
+
+
+#pragma region OIS listeners
+
+bool BufferedInput::keyPressed (const OIS::KeyEvent& event)
+{
+    if (static_cast<std::size_t> (event.key) < keyCount)
+    {
+        m_keysDown[event.key] = true;
+        m_keysPressed[event.key] = true;
+    }
+
+    InputEvent input {  };
+    input.type = InputEvent::Type::KeyPressed;
+    input.key = event.key;
+
+    dispatch (input);
+    return true;
+}
+
+
+bool BufferedInput::keyReleased (const OIS::KeyEvent& event)
+{
+    if (static_cast<std::size_t> (event.key) < keyCount)
+    {
+        m_keysDown[event.key] = false;
+    }
+
+    InputEvent input {  };
+    input.type = InputEvent::Type::KeyReleased;
+    input.key = event.key;
+
+    dispatch (input);
+    return true;
+}
+
+
+bool BufferedInput::mouseMoved (const OIS::MouseEvent& event)
+{
+    m_mouseState = event.state;
+    m_mouseX += event.state.X.rel;
+    m_mouseY += event.state.Y.rel;
+
+    InputEvent input {  };
+    input.type = InputEvent::Type::MouseMoved;
+    input.x = event.state.X.rel;
+    input.y = event.state.Y.rel;
+    input.z = event.state.Z.rel;
+
+    dispatch (input);
+    return true;
+}
+
+
+bool BufferedInput::mousePressed (const OIS::MouseEvent& event, OIS::MouseButtonID button)
+{
+    m_mouseState = event.state;
+
+    InputEvent input {  };
+    input.type = InputEvent::Type::MousePressed;
+    input.button = button;
+
+    dispatch (input);
+    return true;
+}
+
+
+bool BufferedInput::mouseReleased (const OIS::MouseEvent& event, OIS::MouseButtonID button)
+{
+    m_mouseState = event.state;
+
+    InputEvent input {  };
+    input.type = InputEvent::Type::MouseReleased;
+    input.button = button;
+
+    dispatch (input);
+    return true;
+}
+
+#pragma endregion
+
+
+#pragma region Helper functions
+
+void BufferedInput::dispatch (InputEvent& event)
+{
+    event.time = m_timer.getMicroseconds();
+
+    for (auto i = m_queues.begin(); i != m_queues.end(); )
+    {
+        const auto queue = i->lock();
+
+        if (!queue)
+        {
+            i = m_queues.erase (i);
+            continue;
+        }
+
+        // A full queue means the consumer has stalled, dropping the event is preferable to blocking the thread which captures input.
+        queue->push (event);
+        ++i;
+    }
+}
+
+#pragma endregion
\ No newline at end of file
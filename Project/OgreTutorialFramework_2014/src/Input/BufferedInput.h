@@ -0,0 +1,130 @@
+#pragma once
+
+#ifndef _BUFFERED_INPUT_
+#define _BUFFERED_INPUT_
+
+
+// STL headers.
+#include <memory>
+#include <vector>
+
+
+// Engine headers.
+#include <Misc/SPSCQueue.h>
+
+
+/// <summary>
+/// A single timestamped keyboard or mouse event.
+/// </summary>
+struct InputEvent final
+{
+    /// <summary> The kind of event, this decides which of the remaining members are meaningful. </summary>
+    enum class Type
+    {
+        KeyPressed,
+        KeyReleased,
+        MouseMoved,
+        MousePressed,
+        MouseReleased
+    };
+
+    Type                type    { Type::KeyPressed };   //!< What happened.
+    unsigned long       time    { 0 };                  //!< When the event was received in microseconds, only use the difference of two timestamps.
+    OIS::KeyCode        key     { OIS::KC_UNASSIGNED }; //!< The key pressed or released.
+    OIS::MouseButtonID  button  { OIS::MB_Left };       //!< The mouse button pressed or released.
+    int                 x       { 0 };                  //!< The relative horizontal movement of the mouse.
+    int                 y       { 0 };                  //!< The relative vertical movement of the mouse.
+    int                 z       { 0 };                  //!< The relative movement of the mouse wheel.
+};
+
+
+/// <summary> A queue of input events consumed by a single thread. </summary>
+typedef SPSCQueue<InputEvent> InputQueue;
+
+
+/// <summary>
+/// Receives buffered OIS events as they're captured, so taps shorter than a frame are never missed. The thread which captures the devices
+/// can query the key state and mouse movement without touching the devices, every other consumer subscribes to its own lock-free queue.
+/// </summary>
+class BufferedInput final : public OIS::KeyListener, public OIS::MouseListener
+{
+    public:
+
+        #pragma region Constructors and destructor
+
+        BufferedInput();
+        ~BufferedInput() override final;
+
+        // The devices hold a pointer to us so we must stay put.
+        BufferedInput (BufferedInput&& move)                    = delete;
+        BufferedInput& operator= (BufferedInput&& move)         = delete;
+        BufferedInput (const BufferedInput& copy)               = delete;
+        BufferedInput& operator= (const BufferedInput& copy)    = delete;
+
+        #pragma endregion
+
+        #pragma region Capturing thread interface
+
+        /// <summary> Checks whether a key is held down according to the events received so far. </summary>
+        bool isKeyDown (const OIS::KeyCode key) const;
+
+        /// <summary> Checks whether a key was pressed since beginFrame(), even if it has already been released. </summary>
+        bool wasPressed (const OIS::KeyCode key) const;
+
+        /// <summary> Gets the horizontal mouse movement since beginFrame(). </summary>
+        int getMouseX() const                           { return m_mouseX; }
+
+        /// <summary> Gets the vertical mouse movement since beginFrame(). </summary>
+        int getMouseY() const                           { return m_mouseY; }
+
+        /// <summary> Gets the mouse state given with the most recent mouse event. </summary>
+        const OIS::MouseState& getMouseState() const    { return m_mouseState; }
+
+        /// <summary> Clears the key presses and mouse movement of the previous frame, this should be called before capturing the devices. </summary>
+        void beginFrame();
+
+        /// <summary> Creates a queue which receives every event from now on, the subscription ends when the queue is destroyed. </summary>
+        /// <param name="capacity"> How many events can wait in the queue, events are dropped whilst it's full. </param>
+        /// <returns> The queue, this should be consumed by a single thread. </returns>
+        std::shared_ptr<InputQueue> subscribe (const std::size_t capacity = 1024);
+
+        #pragma endregion
+
+        #pragma region OIS listeners
+
+        bool keyPressed (const OIS::KeyEvent& event) override final;
+        bool keyReleased (const OIS::KeyEvent& event) override final;
+
+        bool mouseMoved (const OIS::MouseEvent& event) override final;
+        bool mousePressed (const OIS::MouseEvent& event, OIS::MouseButtonID button) override final;
+        bool mouseReleased (const OIS::MouseEvent& event, OIS::MouseButtonID button) override final;
+
+        #pragma endregion
+
+    private:
+
+        #pragma region Helper functions
+
+        /// <summary> Timestamps an event and pushes it to every subscribed queue, forgetting queues which have been destroyed. </summary>
+        void dispatch (InputEvent& event);
+
+        #pragma endregion
+
+        #pragma region Implementation data
+
+        Ogre::Timer                                 m_timer         {  };   //!< Timestamps each event.
+
+        std::vector<bool>                           m_keysDown      {  };   //!< Whether each key code is held down.
+        std::vector<bool>                           m_keysPressed   {  };   //!< Whether each key code was pressed this frame.
+
+        OIS::MouseState                             m_mouseState    {  };   //!< The most recent mouse state.
+        int                                         m_mouseX        { 0 };  //!< The horizontal mouse movement this frame.
+        int                                         m_mouseY        { 0 };  //!< The vertical mouse movement this frame.
+
+        std::vector<std::weak_ptr<InputQueue>>      m_queues        {  };   //!< Every subscribed queue.
+
+        #pragma endregion
+
+};
+
+#endif // _BUFFERED_INPUT_
\ No newline at end of file
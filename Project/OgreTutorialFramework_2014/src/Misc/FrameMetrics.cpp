@@ -0,0 +1,191 @@
+#include "FrameMetrics.h"
+
+
+
+// STL headers.
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+
+
+
+// Globals.
+const unsigned int defaultMaxSubSteps { 64 };  //!< Enough for every step to fit in a bucket when the simulation isn't fast-forwarded.
+
+
+
+// Helper functions.
+
+/// <summary> Writes the p50, p95, p99 and max of a histogram as comma separated values. </summary>
+static void writePercentiles (std::ostream& stream, const RollingHistogram& histogram)
+{
+    stream  << histogram.percentile (50.0) << "," << histogram.percentile (95.0) << ","
+            << histogram.percentile (99.0) << "," << histogram.getMax();
+}
+
+
+/// <summary> Writes the p50, p95, p99 and max of a histogram in a human readable form. </summary>
+static void describePercentiles (std::ostream& stream, const char* const name, const RollingHistogram& histogram)
+{
+    stream  << name << " p50 " << histogram.percentile (50.0) << " p95 " << histogram.percentile (95.0)
+            << " p99 " << histogram.percentile (99.0) << " max " << histogram.getMax();
+}
+
+
+
+#pragma region Constructors and destructor
+
+FrameMetrics::FrameMetrics()
+    : m_subSteps (1.0, defaultMaxSubSteps + 1)
+{
+}
+
+
+FrameMetrics::FrameMetrics (FrameMetrics&& move)
+{
+    *this = std::move (move);
+}
+
+
+FrameMetrics& FrameMetrics::operator= (FrameMetrics&& move)
+{
+    if (this != &move)
+    {
+        // FrameMetrics. The timer can't be moved so we continue with our own.
+        m_frameTimes = std::move (move.m_frameTimes);
+        m_simulationTimes = std::move (move.m_simulationTimes);
+        m_renderTimes = std::move (move.m_renderTimes);
+        m_subSteps = std::move (move.m_subSteps);
+
+        m_csv = std::move (move.m_csv);
+        m_csvInterval = std::move (move.m_csvInterval);
+        m_sinceRow = std::move (move.m_sinceRow);
+        m_elapsed = std::move (move.m_elapsed);
+        m_frames = std::move (move.m_frames);
+    }
+
+    return *this;
+}
+
+
+FrameMetrics::~FrameMetrics()
+{
+    closeCSV();
+}
+
+#pragma endregion
+
+
+#pragma region Getters and setters
+
+void FrameMetrics::setMaxSubSteps (const unsigned int steps)
+{
+    // The final bucket holds the maximum itself, the overflow bucket beyond it should never be used.
+    m_subSteps = RollingHistogram (1.0, steps + 1);
+}
+
+#pragma endregion
+
+
+#pragma region Public interface
+
+void FrameMetrics::addFrame (const double frameTime, const double simulationTime, const double renderTime, const unsigned int subSteps)
+{
+    m_frameTimes.add (frameTime);
+    m_simulationTimes.add (simulationTime);
+    m_renderTimes.add (renderTime);
+    m_subSteps.add (static_cast<double> (subSteps));
+
+    // Write the time series if necessary.
+    if (m_csv.is_open())
+    {
+        m_elapsed += frameTime / 1000.0;
+        m_sinceRow += frameTime / 1000.0;
+        ++m_frames;
+
+        if (m_sinceRow >= m_csvInterval)
+        {
+            writeRow();
+            m_sinceRow = 0.0;
+        }
+    }
+}
+
+
+bool FrameMetrics::openCSV (const std::string& file, const double interval)
+{
+    closeCSV();
+
+    m_csv.open (file, std::ios::out | std::ios::trunc);
+
+    if (!m_csv.is_open())
+    {
+        std::cerr << "FrameMetrics::openCSV(), unable to open \"" << file << "\"." << std::endl;
+        return false;
+    }
+
+    m_csvInterval = interval > 0.0 ? interval : 1.0;
+    m_sinceRow = 0.0;
+    m_elapsed = 0.0;
+    m_frames = 0;
+
+    m_csv   << "time_s,frames,"
+            << "frame_p50_ms,frame_p95_ms,frame_p99_ms,frame_max_ms,"
+            << "simulation_p50_ms,simulation_p95_ms,simulation_p99_ms,simulation_max_ms,"
+            << "render_p50_ms,render_p95_ms,render_p99_ms,render_max_ms,"
+            << "substeps_p50,substeps_p95,substeps_p99,substeps_max" << std::endl;
+
+    return true;
+}
+
+
+void FrameMetrics::closeCSV()
+{
+    if (m_csv.is_open())
+    {
+        // Don't lose the final partial interval.
+        if (m_sinceRow > 0.0)
+        {
+            writeRow();
+        }
+
+        m_csv.close();
+    }
+}
+
+
+std::string FrameMetrics::summary() const
+{
+    std::ostringstream stream {  };
+    stream << std::fixed << std::setprecision (1);
+
+    describePercentiles (stream, "Frame ms", m_frameTimes);
+    describePercentiles (stream, " | Sim ms", m_simulationTimes);
+    describePercentiles (stream, " | Render ms", m_renderTimes);
+
+    stream << std::setprecision (0);
+    describePercentiles (stream, " | Steps", m_subSteps);
+
+    return stream.str();
+}
+
+#pragma endregion
+
+
+#pragma region Helper functions
+
+void FrameMetrics::writeRow()
+{
+    m_csv << m_elapsed << "," << m_frames << ",";
+
+    writePercentiles (m_csv, m_frameTimes);
+    m_csv << ",";
+    writePercentiles (m_csv, m_simulationTimes);
+    m_csv << ",";
+    writePercentiles (m_csv, m_renderTimes);
+    m_csv << ",";
+    writePercentiles (m_csv, m_subSteps);
+    m_csv << "\n";
+}
+
+#pragma endregion
\ No newline at end of file
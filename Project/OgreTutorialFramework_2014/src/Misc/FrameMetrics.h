@@ -0,0 +1,111 @@
+#pragma once
+
+#ifndef _FRAME_METRICS_
+#define _FRAME_METRICS_
+
+
+// STL headers.
+#include <fstream>
+#include <string>
+
+
+// Engine headers.
+#include <Misc/RollingHistogram.h>
+
+
+/// <summary>
+/// Tracks rolling histograms of the frame, simulation and render times along with the number of simulation sub-steps per frame. Tail latency
+/// is reported as p50/p95/p99/max and can be written periodically to a CSV file as a time series.
+/// </summary>
+class FrameMetrics final
+{
+    public:
+
+        #pragma region Constructors and destructor
+
+        FrameMetrics();
+
+        FrameMetrics (FrameMetrics&& move);
+        FrameMetrics& operator= (FrameMetrics&& move);
+
+        ~FrameMetrics();
+
+        FrameMetrics (const FrameMetrics& copy)             = delete;
+        FrameMetrics& operator= (const FrameMetrics& copy)  = delete;
+
+        #pragma endregion
+
+        #pragma region Getters and setters
+
+        /// <summary> Gets the rolling histogram of whole frame times in milliseconds. </summary>
+        const RollingHistogram& getFrameTimes() const       { return m_frameTimes; }
+
+        /// <summary> Gets the rolling histogram of the time spent stepping the simulation each frame in milliseconds, on whichever thread stepped it. </summary>
+        const RollingHistogram& getSimulationTimes() const  { return m_simulationTimes; }
+
+        /// <summary> Gets the rolling histogram of render times in milliseconds. </summary>
+        const RollingHistogram& getRenderTimes() const      { return m_renderTimes; }
+
+        /// <summary> Gets the rolling histogram of simulation sub-steps per frame. </summary>
+        const RollingHistogram& getSubSteps() const         { return m_subSteps; }
+
+        /// <summary> Sizes the sub-step histogram so every count up to the given number has its own bucket, this discards any recorded sub-steps. </summary>
+        void setMaxSubSteps (const unsigned int steps);
+
+        /// <summary> Gets a timestamp in microseconds for measuring sections of a frame, it wraps around so only use the difference of two timestamps. </summary>
+        unsigned long now()                                 { return m_timer.getMicroseconds(); }
+
+        #pragma endregion
+
+        #pragma region Public interface
+
+        /// <summary> Records the measurements of a single frame. </summary>
+        /// <param name="frameTime"> The duration of the whole frame in milliseconds. </param>
+        /// <param name="simulationTime"> The time spent stepping the simulation in milliseconds. </param>
+        /// <param name="renderTime"> The time spent rendering in milliseconds. </param>
+        /// <param name="subSteps"> The number of fixed simulation steps performed. </param>
+        void addFrame (const double frameTime, const double simulationTime, const double renderTime, const unsigned int subSteps);
+
+        /// <summary> Starts writing a row of percentiles to a CSV file at a regular interval, any previous file is closed. </summary>
+        /// <param name="file"> The location of the CSV file, it is overwritten. </param>
+        /// <param name="interval"> How often in seconds of frame time to write a row. </param>
+        /// <returns> Whether the file could be opened. </returns>
+        bool openCSV (const std::string& file, const double interval = 1.0);
+
+        /// <summary> Writes a final row and closes the CSV file. </summary>
+        void closeCSV();
+
+        /// <summary> Produces a single line summarising the percentiles of each histogram, suitable for an overlay or the console. </summary>
+        std::string summary() const;
+
+        #pragma endregion
+
+    private:
+
+        #pragma region Helper functions
+
+        /// <summary> Writes the current percentiles to the CSV file. </summary>
+        void writeRow();
+
+        #pragma endregion
+
+        #pragma region Implementation data
+
+        Ogre::Timer         m_timer             {  };       //!< Used to time sections of a frame.
+
+        RollingHistogram    m_frameTimes        {  };       //!< Whole frame times in milliseconds.
+        RollingHistogram    m_simulationTimes   {  };       //!< Simulation times in milliseconds.
+        RollingHistogram    m_renderTimes       {  };       //!< Render times in milliseconds.
+        RollingHistogram    m_subSteps          {  };       //!< Simulation sub-steps per frame.
+
+        std::ofstream       m_csv               {  };       //!< The time series output, if open.
+        double              m_csvInterval       { 1.0 };    //!< How many seconds pass between each row.
+        double              m_sinceRow          { 0.0 };    //!< Seconds of frame time since the last row was written.
+        double              m_elapsed           { 0.0 };    //!< Seconds of frame time since the CSV file was opened.
+        unsigned long       m_frames            { 0 };      //!< The number of frames recorded since the CSV file was opened.
+
+        #pragma endregion
+
+};
+
+#endif // _FRAME_METRICS_
\ No newline at end of file
@@ -0,0 +1,184 @@
+#include "FramePacer.h"
+
+
+
+// STL headers.
+#include <chrono>
+#include <thread>
+
+
+
+// Engine headers.
+#include <Utility/Maths.h>
+
+
+
+// Windows headers.
+#if defined (_WIN32)
+    #include <Windows.h>
+    #include <mmsystem.h>
+#endif
+
+
+
+// Globals.
+const unsigned long sleepMargin { 500 };    //!< Even with a 1ms timer period a sleep can overrun slightly, so the final microseconds of a wait are spent yielding.
+
+
+
+#pragma region Constructors and destructor
+
+FramePacer::FramePacer()
+{
+    // Every pacer ends the period it began so the resolution is restored once the last one is destroyed.
+    #if defined (_WIN32)
+        timeBeginPeriod (1);
+    #endif
+
+    start();
+}
+
+
+FramePacer::FramePacer (FramePacer&& move)
+    : FramePacer()
+{
+    *this = std::move (move);
+}
+
+
+FramePacer& FramePacer::operator= (FramePacer&& move)
+{
+    if (this != &move)
+    {
+        // FramePacer. The timer can't be moved so we continue with our own.
+        m_targetFrameTime = std::move (move.m_targetFrameTime);
+
+        m_frameCount = std::move (move.m_frameCount);
+        m_lastFrameTime = std::move (move.m_lastFrameTime);
+        m_minFrameTime = std::move (move.m_minFrameTime);
+        m_maxFrameTime = std::move (move.m_maxFrameTime);
+        m_totalFrameTime = std::move (move.m_totalFrameTime);
+        m_idleTime = std::move (move.m_idleTime);
+
+        start();
+    }
+
+    return *this;
+}
+
+
+FramePacer::~FramePacer()
+{
+    #if defined (_WIN32)
+        timeEndPeriod (1);
+    #endif
+}
+
+#pragma endregion
+
+
+#pragma region Getters and setters
+
+double FramePacer::getAverageFrameTime() const
+{
+    return m_frameCount == 0 ? 0.0 : m_totalFrameTime / m_frameCount * 0.000001;
+}
+
+
+void FramePacer::setTargetFrameRate (const double framesPerSecond)
+{
+    m_targetFrameTime = framesPerSecond > 0.0 ? static_cast<unsigned long> (1000000.0 / framesPerSecond) : 0;
+}
+
+
+void FramePacer::resetStatistics()
+{
+    m_frameCount = 0;
+    m_lastFrameTime = 0;
+    m_minFrameTime = 0;
+    m_maxFrameTime = 0;
+    m_totalFrameTime = 0.0;
+    m_idleTime = 0.0;
+}
+
+#pragma endregion
+
+
+#pragma region Pacing
+
+void FramePacer::start()
+{
+    m_timer.reset();
+    m_frameStart = m_timer.getMicroseconds();
+}
+
+
+double FramePacer::beginFrame()
+{
+    // Spend the rest of the budget idle if we're limiting the frame rate.
+    if (m_targetFrameTime != 0)
+    {
+        waitUntil (m_targetFrameTime);
+    }
+
+    // Never report an empty frame, yield until time has actually passed.
+    unsigned long frameTime { elapsed() };
+
+    while (frameTime == 0)
+    {
+        std::this_thread::yield();
+        frameTime = elapsed();
+    }
+
+    // Begin the next frame exactly where this one ended so no time is lost.
+    m_frameStart += frameTime;
+
+    // Update the statistics.
+    m_minFrameTime = m_frameCount == 0 ? frameTime : util::min (m_minFrameTime, frameTime);
+    m_maxFrameTime = util::max (m_maxFrameTime, frameTime);
+    m_lastFrameTime = frameTime;
+    m_totalFrameTime += frameTime;
+    ++m_frameCount;
+
+    return frameTime * 0.000001;
+}
+
+#pragma endregion
+
+
+#pragma region Helper functions
+
+unsigned long FramePacer::elapsed()
+{
+    // Unsigned subtraction gives the correct result even when the timer wraps around.
+    return m_timer.getMicroseconds() - m_frameStart;
+}
+
+
+void FramePacer::waitUntil (const unsigned long until)
+{
+    const unsigned long before  { elapsed() };
+    unsigned long       now     { before };
+
+    while (now < until)
+    {
+        const unsigned long remaining { until - now };
+
+        // Sleep through the bulk of the wait and yield for the rest so we're not late.
+        if (remaining > sleepMargin)
+        {
+            std::this_thread::sleep_for (std::chrono::microseconds (remaining - sleepMargin));
+        }
+
+        else
+        {
+            std::this_thread::yield();
+        }
+
+        now = elapsed();
+    }
+
+    m_idleTime += now - before;
+}
+
+#pragma endregion
\ No newline at end of file
@@ -0,0 +1,103 @@
+#pragma once
+
+#ifndef _FRAME_PACER_
+#define _FRAME_PACER_
+
+
+/// <summary>
+/// Measures frame times with microsecond resolution and optionally limits the frame rate by sleeping away the unused budget instead of spinning.
+/// On Windows each pacer raises the system timer resolution to 1ms whilst it exists, otherwise sleeps are rounded up to 15.6ms.
+/// </summary>
+class FramePacer final
+{
+    public:
+
+        #pragma region Constructors and destructor
+
+        FramePacer();
+
+        FramePacer (FramePacer&& move);
+        FramePacer& operator= (FramePacer&& move);
+
+        ~FramePacer();
+
+        FramePacer (const FramePacer& copy)             = delete;
+        FramePacer& operator= (const FramePacer& copy)  = delete;
+
+        #pragma endregion
+
+        #pragma region Getters and setters
+
+        /// <summary> Gets the target frames per second, 0.0 means the frame rate isn't limited. </summary>
+        double getTargetFrameRate() const               { return m_targetFrameTime == 0 ? 0.0 : 1000000.0 / m_targetFrameTime; }
+
+        /// <summary> Gets the number of frames measured since the statistics were last reset. </summary>
+        unsigned long getFrameCount() const             { return m_frameCount; }
+
+        /// <summary> Gets the duration of the most recent frame in seconds. </summary>
+        double getLastFrameTime() const                 { return m_lastFrameTime * 0.000001; }
+
+        /// <summary> Gets the shortest frame in seconds since the statistics were last reset. </summary>
+        double getMinFrameTime() const                  { return m_frameCount == 0 ? 0.0 : m_minFrameTime * 0.000001; }
+
+        /// <summary> Gets the longest frame in seconds since the statistics were last reset. </summary>
+        double getMaxFrameTime() const                  { return m_maxFrameTime * 0.000001; }
+
+        /// <summary> Gets the mean frame time in seconds since the statistics were last reset. </summary>
+        double getAverageFrameTime() const;
+
+        /// <summary> Gets the total time in seconds spent sleeping or yielding to meet the target frame rate. </summary>
+        double getIdleTime() const                      { return m_idleTime * 0.000001; }
+
+        /// <summary> Sets the desired frames per second. </summary>
+        /// <param name="framesPerSecond"> Values of 0.0 or less remove the limit. </param>
+        void setTargetFrameRate (const double framesPerSecond);
+
+        /// <summary> Clears the frame time statistics without affecting the frame being measured. </summary>
+        void resetStatistics();
+
+        #pragma endregion
+
+        #pragma region Pacing
+
+        /// <summary> Starts measuring frames from now, this should be called before the first call to beginFrame(). </summary>
+        void start();
+
+        /// <summary> Waits until the frame budget has been used, then begins a new frame. </summary>
+        /// <returns> The time in seconds since the previous frame began. </returns>
+        double beginFrame();
+
+        #pragma endregion
+
+    private:
+
+        #pragma region Helper functions
+
+        /// <summary> Gets the microseconds passed since the current frame began, this handles the timer wrapping around. </summary>
+        unsigned long elapsed();
+
+        /// <summary> Sleeps for all but the last fraction of a millisecond and yields for the remainder, this avoids spinning a core. </summary>
+        /// <param name="until"> The number of microseconds since the frame began to wait until. </param>
+        void waitUntil (const unsigned long until);
+
+        #pragma endregion
+
+        #pragma region Implementation data
+
+        Ogre::Timer         m_timer             {  };       //!< A high resolution timer used for every measurement.
+
+        unsigned long       m_frameStart        { 0 };      //!< The timer value when the current frame began, in microseconds.
+        unsigned long       m_targetFrameTime   { 0 };      //!< The desired frame duration in microseconds, 0 if unlimited.
+
+        unsigned long       m_frameCount        { 0 };      //!< The number of frames measured.
+        unsigned long       m_lastFrameTime     { 0 };      //!< The duration of the most recent frame in microseconds.
+        unsigned long       m_minFrameTime      { 0 };      //!< The shortest frame in microseconds.
+        unsigned long       m_maxFrameTime      { 0 };      //!< The longest frame in microseconds.
+        double              m_totalFrameTime    { 0.0 };    //!< The accumulated frame time in microseconds.
+        double              m_idleTime          { 0.0 };    //!< The accumulated waiting time in microseconds.
+
+        #pragma endregion
+
+};
+
+#endif // _FRAME_PACER_
\ No newline at end of file
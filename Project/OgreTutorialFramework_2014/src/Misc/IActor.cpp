@@ -8,22 +8,139 @@
 
 
 // Engine headers.
-#include <Framework/OgreApplication.h>
+#include <Misc/StateBuffer.h>
+#include <Misc/TransformBuffer.h>
+#include <Utility/Ogre.h>
 
 
 
-#pragma region Ogre creation
+#pragma region Interpolation
 
-Ogre::Entity* IActor::constructEntity (OgreApplication* const ogre, const Ogre::String& mesh, const Ogre::String& material)
+void IActor::beginStep()
 {
-    // Create the entity.
-    auto entity = ogre->GetSceneManager()->createEntity (mesh);
-    entity->setCastShadows (false);
+    m_previousPosition = m_position;
+    m_previousOrientation = m_orientation;
+}
 
-    // Set the material to be used.
-    entity->setMaterialName (material);
-    
-    return entity;
+
+void IActor::interpolate (const float alpha)
+{
+    m_node->setPosition (m_previousPosition + (m_position - m_previousPosition) * alpha);
+    m_node->setOrientation (Ogre::Quaternion::nlerp (alpha, m_previousOrientation, m_orientation, true));
+    m_node->setScale (m_scale);
+}
+
+
+void IActor::clearInterpolation()
+{
+    // Blending between identical transforms will display the actor exactly where it is.
+    beginStep();
+}
+
+
+void IActor::syncNode()
+{
+    m_node->setPosition (m_position);
+    m_node->setOrientation (m_orientation);
+    m_node->setScale (m_scale);
+}
+
+
+void IActor::publish (TransformSnapshot& snapshot) const
+{
+    ActorTransform transform {  };
+
+    transform.node = m_node;
+    transform.previousPosition = m_previousPosition;
+    transform.previousOrientation = m_previousOrientation;
+    transform.position = m_position;
+    transform.orientation = m_orientation;
+    transform.scale = m_scale;
+
+    snapshot.transforms.push_back (transform);
+}
+
+#pragma endregion
+
+
+#pragma region State
+
+void IActor::saveState (StateBuffer& buffer) const
+{
+    buffer.write (m_position);
+    buffer.write (m_orientation);
+    buffer.write (m_scale);
+    buffer.write (m_previousPosition);
+    buffer.write (m_previousOrientation);
+}
+
+
+void IActor::restoreState (StateBuffer& buffer)
+{
+    buffer.read (m_position);
+    buffer.read (m_orientation);
+    buffer.read (m_scale);
+    buffer.read (m_previousPosition);
+    buffer.read (m_previousOrientation);
+}
+
+#pragma endregion
+
+
+#pragma region Getters and setters
+
+void IActor::rotate (const Ogre::Quaternion& rotation, const Ogre::Node::TransformSpace space)
+{
+    // Ogre normalises the rotation to avoid drift so we'll do the same.
+    Ogre::Quaternion normalised { rotation };
+    normalised.normalise();
+
+    switch (space)
+    {
+        case Ogre::Node::TS_PARENT:
+        case Ogre::Node::TS_WORLD:
+            m_orientation = normalised * m_orientation;
+            break;
+
+        case Ogre::Node::TS_LOCAL:
+        default:
+            m_orientation = m_orientation * normalised;
+            break;
+    }
+}
+
+
+void IActor::setDirection (const Ogre::Vector3& direction, const Ogre::Vector3& localDirection)
+{
+    // Pre-condition: We can't face a zero vector.
+    if (direction == Ogre::Vector3::ZERO)
+    {
+        return;
+    }
+
+    const auto target   = direction.normalisedCopy(),
+               current  = m_orientation * localDirection;
+
+    // A 180 degree turn has no unique rotation, Ogre handles it by flipping around the local axes.
+    if ((current + target).squaredLength() < 0.00005f)
+    {
+        m_orientation = Ogre::Quaternion (-m_orientation.y, -m_orientation.z, m_orientation.w, m_orientation.x);
+    }
+
+    else
+    {
+        m_orientation = current.getRotationTo (target) * m_orientation;
+    }
+}
+
+#pragma endregion
+
+
+#pragma region Ogre creation
+
+Ogre::MovableObject* IActor::constructEntity (OgreApplication* const ogre, const Ogre::String& mesh, const Ogre::String& material)
+{
+    return util::createEntity (ogre, mesh, material);
 }
 
 
@@ -44,11 +161,16 @@ Ogre::SceneNode* IActor::constructNode (Ogre::SceneNode* const root, const Ogre:
         node->attachObject (attachable);
     }
 
-    // Set up the default node values.
+    // Set up the default node values, the simulated transform starts from the same place.
     node->setPosition (position);
     node->setOrientation (orientation);
     node->setScale (scale);
 
+    m_position = position;
+    m_orientation = orientation;
+    m_scale = scale;
+    IActor::clearInterpolation();
+
     // We're done! Yay!
     return node;
 }
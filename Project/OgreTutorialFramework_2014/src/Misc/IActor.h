@@ -6,10 +6,13 @@
 
 // Forward declarations.
 class OgreApplication;
+class StateBuffer;
+struct TransformSnapshot;
 
 
 /// <summary>
-/// A basic actor interface, should be used for all in-game actors.
+/// A basic actor interface, should be used for all in-game actors. Actors simulate their own copy of their transform so that the simulation never
+/// touches the scene graph, the SceneNode is only written to when synchronised, interpolated or when a published snapshot is applied.
 /// </summary>
 class IActor
 {
@@ -21,7 +24,7 @@ class IActor
         virtual ~IActor() {}
 
         /// <summary> Causes an Actor to initialise itself. This should be called before using any Actor. </summary>
-        /// <param name="ogre"> The OgreApplication used for creating entities. </param>
+        /// <param name="ogre"> The OgreApplication used for creating entities, a nullptr will create a headless actor with no entities. </param>
         /// <param name="root"> The SceneNode to attach the actor to. </param>
         /// <param name="name"> The name to instantiate the SceneNode with. </param>
         /// <returns> Returns whether the initialisation worked or not. </returns>
@@ -37,17 +40,60 @@ class IActor
 
         #pragma endregion
 
+        #pragma region Interpolation
+
+        /// <summary> Remembers the current transform as the previous state, this should be called before each fixed simulation step. </summary>
+        virtual void beginStep();
+
+        /// <summary> Writes a blend of the previous and current transform to the SceneNode. The simulated transform is unaffected. </summary>
+        /// <param name="alpha"> How far between the previous (0.f) and current (1.f) step to render the actor. </param>
+        virtual void interpolate (const float alpha);
+
+        /// <summary> Discards the previous transform, this should be called when the transform has been set externally, e.g. when resetting. </summary>
+        virtual void clearInterpolation();
+
+        /// <summary> Writes the simulated transform to the SceneNode exactly as it is. </summary>
+        void syncNode();
+
+        /// <summary> Appends the previous and current transform of the actor to a snapshot so another thread can apply them to the SceneNode. </summary>
+        /// <param name="snapshot"> The snapshot being written by the simulation. </param>
+        virtual void publish (TransformSnapshot& snapshot) const;
+
+        #pragma endregion
+
+        #pragma region State
+
+        /// <summary> Appends the simulated state of the actor to a buffer so it can be restored later without repeating any setup. </summary>
+        /// <param name="buffer"> The buffer to append to. </param>
+        virtual void saveState (StateBuffer& buffer) const;
+
+        /// <summary> Reads back the state written by saveState(). The SceneNode is left alone, it's updated when next interpolated or published. </summary>
+        /// <param name="buffer"> The buffer to read from, it must be positioned where saveState() began writing. </param>
+        virtual void restoreState (StateBuffer& buffer);
+
+        #pragma endregion
+
         #pragma region Getters and setters
 
         Ogre::SceneNode* const getNode() const                      { return m_node; }
 
-        const Ogre::Vector3& getPosition() const                    { return m_node->getPosition(); }
-        const Ogre::Quaternion& getOrientation() const              { return m_node->getOrientation(); }
-        const Ogre::Vector3& getScale() const                       { return m_node->getScale(); }
+        const Ogre::Vector3& getPosition() const                    { return m_position; }
+        const Ogre::Quaternion& getOrientation() const              { return m_orientation; }
+        const Ogre::Vector3& getScale() const                       { return m_scale; }
 
-        void setPosition (const Ogre::Vector3& position)            { m_node->setPosition (position); }
-        void setOrientation (const Ogre::Quaternion& orientation)   { m_node->setOrientation (orientation); }
-        void setScale (const Ogre::Vector3& scale)                  { m_node->setScale (scale); }
+        void setPosition (const Ogre::Vector3& position)            { m_position = position; }
+        void setOrientation (const Ogre::Quaternion& orientation)   { m_orientation = orientation; }
+        void setScale (const Ogre::Vector3& scale)                  { m_scale = scale; }
+
+        /// <summary> Rotates the actor in the same manner as Ogre::Node::rotate(). World space is treated as parent space because actors are simulated relative to their parent. </summary>
+        /// <param name="rotation"> The rotation to apply. </param>
+        /// <param name="space"> The space to rotate in. </param>
+        void rotate (const Ogre::Quaternion& rotation, const Ogre::Node::TransformSpace space = Ogre::Node::TS_LOCAL);
+
+        /// <summary> Orients the actor so the local direction points along the given direction, in the same manner as Ogre::Node::setDirection() in parent space. </summary>
+        /// <param name="direction"> The direction to face, relative to the parent. </param>
+        /// <param name="localDirection"> The axis of the actor which should face the given direction. </param>
+        void setDirection (const Ogre::Vector3& direction, const Ogre::Vector3& localDirection = Ogre::Vector3::NEGATIVE_UNIT_Z);
 
         #pragma endregion
 
@@ -56,13 +102,13 @@ class IActor
         #pragma region Ogre creation
 
         /// <summary>
-        /// Creates the visual entity for the IActor.
+        /// Creates the visual entity for the IActor. When the null render backend is used a NullDrawable is created instead.
         /// </summary>
-        /// <param name="ogre"> The OgreApplication used for creating entities. </param>
+        /// <param name="ogre"> The OgreApplication used for creating entities. A nullptr indicates a headless actor. </param>
         /// <param name="mesh"> The filename for the mesh to be used. </param>
         /// <param name="material"> The material name to use for the entity. </param>
-        /// <returns> Returns the completed entity. </returns>
-        virtual Ogre::Entity* constructEntity (OgreApplication* const ogre, const Ogre::String& mesh, const Ogre::String& material = "green");
+        /// <returns> Returns the completed entity, a nullptr if the actor is headless. </returns>
+        virtual Ogre::MovableObject* constructEntity (OgreApplication* const ogre, const Ogre::String& mesh, const Ogre::String& material = "green");
 
         /// <summary>
         /// Constructs a SceneNode for an IActor which will used in-game.
@@ -80,7 +126,14 @@ class IActor
 
         #pragma region Implementation data
 
-        Ogre::SceneNode*    m_node  { nullptr };    //!< The in-game SceneNode used to represent the actor.
+        Ogre::SceneNode*    m_node                  { nullptr };            //!< The in-game SceneNode used to represent the actor.
+
+        Ogre::Vector3       m_position              {  };                   //!< The simulated position, only written to the node when synchronised or interpolated.
+        Ogre::Quaternion    m_orientation           {  };                   //!< The simulated orientation, only written to the node when synchronised or interpolated.
+        Ogre::Vector3       m_scale                 { 1.f, 1.f, 1.f };      //!< The simulated scale, only written to the node when synchronised or interpolated.
+
+        Ogre::Vector3       m_previousPosition      {  };                   //!< The position of the actor before the most recent simulation step.
+        Ogre::Quaternion    m_previousOrientation   {  };                   //!< The orientation of the actor before the most recent simulation step.
 
         #pragma endregion
 };
@@ -0,0 +1,317 @@
+#include "JobSystem.h"
+
+
+
+// Engine headers.
+#include <Misc/Profiler.h>
+#include <Utility/Maths.h>
+
+
+
+// Visual Studio 2013 doesn't support thread_local but does support thread local POD variables.
+#if defined (_MSC_VER)
+    #define JOB_THREAD_LOCAL __declspec (thread)
+#else
+    #define JOB_THREAD_LOCAL thread_local
+#endif
+
+
+
+// Globals.
+const std::size_t                   defaultChunks   { 64 };         //!< How many chunks parallelFor() uses when no grain is given.
+
+JOB_THREAD_LOCAL const void*        currentSystem   { nullptr };    //!< The JobSystem the calling thread is a worker of.
+JOB_THREAD_LOCAL unsigned int       currentQueue    { 0 };          //!< The queue owned by the calling worker.
+
+
+
+#pragma region Constructors and destructor
+
+JobSystem::JobSystem (const unsigned int workerCount)
+{
+    // The shared queue comes first so worker queues start from one.
+    for (unsigned int i = 0; i <= workerCount; ++i)
+    {
+        m_queues.push_back (std::make_unique<Queue>());
+    }
+
+    for (unsigned int i = 1; i <= workerCount; ++i)
+    {
+        m_workers.emplace_back (&JobSystem::work, this, i);
+    }
+}
+
+
+JobSystem::~JobSystem()
+{
+    {
+        std::lock_guard<std::mutex> lock (m_sleepMutex);
+        m_stopping = true;
+    }
+
+    m_wake.notify_all();
+
+    for (auto& worker : m_workers)
+    {
+        worker.join();
+    }
+}
+
+#pragma endregion
+
+
+#pragma region Public interface
+
+void JobSystem::run (TaskGroup& group, Job job)
+{
+    group.m_pending.fetch_add (1, std::memory_order_relaxed);
+
+    Task task {  };
+    task.job = std::move (job);
+    task.group = &group;
+
+    if (m_deterministic)
+    {
+        execute (task);
+    }
+
+    else
+    {
+        push (std::move (task));
+    }
+}
+
+
+void JobSystem::then (TaskGroup& after, TaskGroup& group, Job job)
+{
+    // The continuation counts towards its group straight away so waiting on the group can't finish early.
+    group.m_pending.fetch_add (1, std::memory_order_relaxed);
+
+    {
+        // Groups only finish whilst their lock is held, so either the last job takes our continuation or we see the group has finished.
+        std::lock_guard<std::mutex> lock (after.m_mutex);
+
+        if (!after.isFinished())
+        {
+            after.m_continuations.emplace_back (&group, std::move (job));
+            return;
+        }
+    }
+
+    Task task {  };
+    task.job = std::move (job);
+    task.group = &group;
+
+    if (m_deterministic)
+    {
+        execute (task);
+    }
+
+    else
+    {
+        push (std::move (task));
+    }
+}
+
+
+void JobSystem::wait (TaskGroup& group)
+{
+    PROFILE_SCOPE ("JobSystem::wait");
+
+    // Help out rather than sleeping, the jobs we run may well be the ones we're waiting for.
+    while (!group.isFinished())
+    {
+        Task task {  };
+
+        if (pop (task))
+        {
+            execute (task);
+        }
+
+        else
+        {
+            std::this_thread::yield();
+        }
+    }
+
+    // Report failures on the waiting thread.
+    std::exception_ptr error {  };
+
+    {
+        std::lock_guard<std::mutex> lock (group.m_mutex);
+        std::swap (error, group.m_error);
+    }
+
+    if (error)
+    {
+        std::rethrow_exception (error);
+    }
+}
+
+
+void JobSystem::parallelFor (const std::size_t count, const std::size_t grain, const std::function<void (std::size_t, std::size_t)>& body)
+{
+    const std::size_t chunk { grain > 0 ? grain : util::max (count / defaultChunks, static_cast<std::size_t> (1)) };
+
+    TaskGroup group {  };
+
+    for (std::size_t begin = 0; begin < count; begin += chunk)
+    {
+        const std::size_t end { util::min (begin + chunk, count) };
+
+        run (group, [&body, begin, end] () { body (begin, end); });
+    }
+
+    wait (group);
+}
+
+#pragma endregion
+
+
+#pragma region Helper functions
+
+void JobSystem::work (const unsigned int index)
+{
+    PROFILE_THREAD_NAME ("Job worker");
+
+    currentSystem = this;
+    currentQueue = index;
+
+    while (!m_stopping)
+    {
+        Task task {  };
+
+        if (pop (task))
+        {
+            execute (task);
+        }
+
+        else
+        {
+            // Jobs are counted before the notification is sent under this lock, so a wake up can't be missed between checking and sleeping.
+            std::unique_lock<std::mutex> lock (m_sleepMutex);
+            m_wake.wait (lock, [this] () { return m_stopping || m_queued.load() > 0; });
+        }
+    }
+}
+
+
+void JobSystem::push (Task&& task)
+{
+    auto& queue = *m_queues[queueIndex()];
+
+    {
+        std::lock_guard<std::mutex> lock (queue.mutex);
+        queue.tasks.push_back (std::move (task));
+    }
+
+    m_queued.fetch_add (1);
+
+    // Taking the lock means a worker can't be between checking for jobs and sleeping.
+    {
+        std::lock_guard<std::mutex> lock (m_sleepMutex);
+    }
+
+    m_wake.notify_one();
+}
+
+
+bool JobSystem::pop (Task& task)
+{
+    const unsigned int  own     { queueIndex() };
+    const std::size_t   count   { m_queues.size() };
+
+    // Newest first from our own queue keeps nested work in the cache.
+    {
+        auto& queue = *m_queues[own];
+        std::lock_guard<std::mutex> lock (queue.mutex);
+
+        if (!queue.tasks.empty())
+        {
+            task = std::move (queue.tasks.back());
+            queue.tasks.pop_back();
+            m_queued.fetch_sub (1);
+
+            return true;
+        }
+    }
+
+    // Steal the oldest job from the next busy queue, starting after our own so thieves spread out.
+    for (std::size_t i = 1; i < count; ++i)
+    {
+        auto& queue = *m_queues[(own + i) % count];
+        std::lock_guard<std::mutex> lock (queue.mutex);
+
+        if (!queue.tasks.empty())
+        {
+            task = std::move (queue.tasks.front());
+            queue.tasks.pop_front();
+            m_queued.fetch_sub (1);
+
+            return true;
+        }
+    }
+
+    return false;
+}
+
+
+void JobSystem::execute (Task& task)
+{
+    auto& group = *task.group;
+
+    try
+    {
+        task.job();
+    }
+
+    catch (...)
+    {
+        std::lock_guard<std::mutex> lock (group.m_mutex);
+
+        if (!group.m_error)
+        {
+            group.m_error = std::current_exception();
+        }
+    }
+
+    // Release the job first, its captures may refer to things which only live until the group finishes.
+    task.job = nullptr;
+
+    std::vector<std::pair<TaskGroup*, Job>> continuations {  };
+
+    {
+        std::lock_guard<std::mutex> lock (group.m_mutex);
+
+        if (group.m_pending.fetch_sub (1, std::memory_order_acq_rel) == 1)
+        {
+            std::swap (continuations, group.m_continuations);
+        }
+    }
+
+    // Each continuation was counted by its group when it was added.
+    for (auto& continuation : continuations)
+    {
+        Task next {  };
+        next.job = std::move (continuation.second);
+        next.group = continuation.first;
+
+        if (m_deterministic)
+        {
+            execute (next);
+        }
+
+        else
+        {
+            push (std::move (next));
+        }
+    }
+}
+
+
+unsigned int JobSystem::queueIndex() const
+{
+    return currentSystem == this ? currentQueue : 0;
+}
+
+#pragma endregion
\ No newline at end of file
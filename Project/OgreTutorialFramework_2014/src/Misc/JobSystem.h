@@ -0,0 +1,171 @@
+#pragma once
+
+#ifndef _JOB_SYSTEM_
+#define _JOB_SYSTEM_
+
+
+// STL headers.
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+
+/// <summary>
+/// A general purpose work-stealing thread pool. Each worker pushes and pops its own jobs from the back of its queue whilst idle workers steal
+/// from the front of everyone else's, so nested work stays on the thread which created it. Threads waiting on a TaskGroup run jobs rather
+/// than sleeping. In deterministic mode every job runs immediately on the thread which submitted it, in submission order, for replays.
+/// </summary>
+class JobSystem final
+{
+    public:
+
+        /// <summary> A unit of work, any exception thrown is rethrown by wait(). </summary>
+        typedef std::function<void()> Job;
+
+        /// <summary>
+        /// Tracks a set of jobs so they can be waited on together or followed by continuations. A group must be waited on before it's destroyed
+        /// and can be reused afterwards.
+        /// </summary>
+        class TaskGroup final
+        {
+            public:
+
+                TaskGroup()                                     = default;
+                ~TaskGroup()                                    = default;
+
+                // Atomics can't be moved or copied.
+                TaskGroup (TaskGroup&& move)                    = delete;
+                TaskGroup& operator= (TaskGroup&& move)         = delete;
+                TaskGroup (const TaskGroup& copy)               = delete;
+                TaskGroup& operator= (const TaskGroup& copy)    = delete;
+
+                /// <summary> Checks whether every job in the group, including continuations, has finished. </summary>
+                bool isFinished() const                         { return m_pending.load (std::memory_order_acquire) == 0; }
+
+            private:
+
+                friend class JobSystem;
+
+                std::atomic<std::size_t>                m_pending       { 0 };  //!< How many jobs in the group are yet to finish.
+
+                std::mutex                              m_mutex         {  };   //!< Guards every member below.
+                std::vector<std::pair<TaskGroup*, Job>> m_continuations {  };   //!< Jobs to run once the group finishes and the group they join.
+                std::exception_ptr                      m_error         {  };   //!< The first exception thrown by a job in the group.
+        };
+
+        #pragma region Constructors and destructor
+
+        /// <summary> Starts the worker threads. </summary>
+        /// <param name="workerCount"> How many threads to create besides the calling thread, 0 will run every job on the waiting thread. </param>
+        explicit JobSystem (const unsigned int workerCount);
+
+        /// <summary> Stops and joins every worker thread, any queued jobs are discarded. </summary>
+        ~JobSystem();
+
+        JobSystem (JobSystem&& move)                    = delete;
+        JobSystem& operator= (JobSystem&& move)         = delete;
+        JobSystem (const JobSystem& copy)               = delete;
+        JobSystem& operator= (const JobSystem& copy)    = delete;
+
+        #pragma endregion
+
+        #pragma region Getters and setters
+
+        /// <summary> Gets the number of worker threads, the calling thread isn't included. </summary>
+        unsigned int getWorkerCount() const                 { return static_cast<unsigned int> (m_workers.size()); }
+
+        bool isDeterministic() const                        { return m_deterministic; }
+
+        /// <summary>
+        /// Sets whether jobs run immediately on the submitting thread, this must not be changed whilst jobs are outstanding. Deterministic mode
+        /// runs every job serially, including each chunk of parallelFor(), so the workers sit idle.
+        /// </summary>
+        void setDeterministic (const bool deterministic)    { m_deterministic = deterministic; }
+
+        #pragma endregion
+
+        #pragma region Public interface
+
+        /// <summary> Queues a job as part of a group. </summary>
+        void run (TaskGroup& group, Job job);
+
+        /// <summary> Queues a job as part of a group once another group has finished, the job runs immediately if it already has. </summary>
+        /// <param name="after"> The group to wait for. </param>
+        /// <param name="group"> The group the continuation belongs to, waiting on it includes the continuation. </param>
+        void then (TaskGroup& after, TaskGroup& group, Job job);
+
+        /// <summary> Runs queued jobs until the group has finished. The first exception thrown by the group is rethrown here. </summary>
+        void wait (TaskGroup& group);
+
+        /// <summary>
+        /// Splits a range into chunks, runs them across every thread and waits for them. The chunks depend only on the count and grain, never the
+        /// number of workers, so anything calculated per chunk is reproducible.
+        /// </summary>
+        /// <param name="count"> The number of elements in the range. </param>
+        /// <param name="grain"> The number of elements in each chunk, 0 will split the range into 64 chunks. </param>
+        /// <param name="body"> Called with the first element and one past the last element of each chunk. </param>
+        void parallelFor (const std::size_t count, const std::size_t grain, const std::function<void (std::size_t, std::size_t)>& body);
+
+        #pragma endregion
+
+    private:
+
+        /// <summary> A queued job and the group it belongs to. </summary>
+        struct Task final
+        {
+            Job         job     {  };           //!< The work to perform.
+            TaskGroup*  group   { nullptr };    //!< Informed when the job finishes.
+        };
+
+        /// <summary> The jobs queued by a single thread, the owner uses the back and thieves use the front. </summary>
+        struct Queue final
+        {
+            std::mutex          mutex   {  };   //!< Guards the tasks, only contended when a thief visits.
+            std::deque<Task>    tasks   {  };   //!< Every job queued and not yet started.
+        };
+
+        #pragma region Helper functions
+
+        /// <summary> The body of each worker thread. </summary>
+        /// <param name="index"> The queue owned by the worker. </param>
+        void work (const unsigned int index);
+
+        /// <summary> Adds a task to the queue of the calling worker, or the shared queue for other threads, and wakes a worker. </summary>
+        void push (Task&& task);
+
+        /// <summary> Takes a task from the calling thread's own queue, stealing from the other queues when it's empty. </summary>
+        /// <returns> Whether a task was found. </returns>
+        bool pop (Task& task);
+
+        /// <summary> Runs a task and finishes it, starting any continuations if the group is now complete. </summary>
+        void execute (Task& task);
+
+        /// <summary> Gets the queue owned by the calling thread, the shared queue for threads which aren't workers of this system. </summary>
+        unsigned int queueIndex() const;
+
+        #pragma endregion
+
+        #pragma region Implementation data
+
+        std::vector<std::unique_ptr<Queue>> m_queues        {  };           //!< The shared queue followed by the queue of each worker.
+        std::vector<std::thread>            m_workers       {  };           //!< The threads which run jobs alongside waiting threads.
+
+        std::mutex                          m_sleepMutex    {  };           //!< Guards idle workers going to sleep.
+        std::condition_variable             m_wake          {  };           //!< Notified whenever a job is queued or the workers should stop.
+        std::atomic<std::size_t>            m_queued        { 0 };          //!< How many jobs are waiting in any queue.
+        std::atomic<bool>                   m_stopping      { false };      //!< Whether the workers should exit.
+
+        bool                                m_deterministic { false };      //!< Whether jobs run immediately on the submitting thread.
+
+        #pragma endregion
+
+};
+
+#endif // _JOB_SYSTEM_
\ No newline at end of file
@@ -0,0 +1,257 @@
+#include "Profiler.h"
+
+
+#if defined (BADGER_PROFILING_ENABLED)
+
+
+// STL headers.
+#include <chrono>
+#include <fstream>
+#include <iostream>
+
+
+
+// Windows headers.
+#if defined (_WIN32)
+    #include <Windows.h>
+#endif
+
+
+
+// Visual Studio 2013 doesn't support thread_local but does support thread local POD variables.
+#if defined (_MSC_VER)
+    #define PROFILER_THREAD_LOCAL __declspec (thread)
+#else
+    #define PROFILER_THREAD_LOCAL thread_local
+#endif
+
+
+
+// Globals.
+const std::size_t                   maxEventsPerThread  { 1000000 };    //!< Limits the memory used by each thread, roughly 24MB.
+
+Profiler                            profiler            {  };           //!< The application-wide profiler, created before any threads exist.
+PROFILER_THREAD_LOCAL void*         currentBuffer       { nullptr };    //!< The ThreadBuffer belonging to the calling thread.
+
+
+
+// Helper functions.
+
+/// <summary> Reads the highest resolution clock available. </summary>
+static long long readClock()
+{
+    #if defined (_WIN32)
+
+        LARGE_INTEGER counter {  };
+        QueryPerformanceCounter (&counter);
+        return counter.QuadPart;
+
+    #else
+
+        return std::chrono::duration_cast<std::chrono::nanoseconds> (std::chrono::steady_clock::now().time_since_epoch()).count();
+
+    #endif
+}
+
+
+/// <summary> Writes a string to a stream as a JSON string literal. </summary>
+static void writeJSONString (std::ostream& stream, const char* const text)
+{
+    stream << '"';
+
+    for (const char* character = text; *character; ++character)
+    {
+        if (*character == '"' || *character == '\\')
+        {
+            stream << '\\';
+        }
+
+        stream << *character;
+    }
+
+    stream << '"';
+}
+
+
+
+#pragma region Constructors and destructor
+
+Profiler::Profiler()
+{
+    #if defined (_WIN32)
+
+        LARGE_INTEGER frequency {  };
+        QueryPerformanceFrequency (&frequency);
+        m_frequency = frequency.QuadPart;
+
+    #else
+
+        m_frequency = 1000000000;
+
+    #endif
+
+    m_epoch = readClock();
+}
+
+
+Profiler::~Profiler()
+{
+}
+
+#pragma endregion
+
+
+#pragma region Public interface
+
+Profiler& Profiler::instance()
+{
+    return profiler;
+}
+
+
+long long Profiler::now() const
+{
+    // Split the conversion so the multiplication can't overflow on long runs.
+    const long long ticks       { readClock() - m_epoch },
+                    seconds     { ticks / m_frequency },
+                    remainder   { ticks % m_frequency };
+
+    return seconds * 1000000 + remainder * 1000000 / m_frequency;
+}
+
+
+void Profiler::record (const char* const name, const long long start, const long long end)
+{
+    auto& buffer = threadBuffer();
+
+    std::lock_guard<std::mutex> lock (buffer.mutex);
+
+    if (buffer.events.size() < maxEventsPerThread)
+    {
+        ThreadBuffer::Event event {  };
+        event.name = name;
+        event.start = start;
+        event.end = end;
+
+        buffer.events.push_back (event);
+    }
+
+    else
+    {
+        ++buffer.dropped;
+    }
+}
+
+
+void Profiler::setThreadName (const std::string& name)
+{
+    auto& buffer = threadBuffer();
+
+    std::lock_guard<std::mutex> lock (buffer.mutex);
+    buffer.name = name;
+}
+
+
+bool Profiler::writeChromeTrace (const std::string& file)
+{
+    std::ofstream output { file, std::ios::out | std::ios::trunc };
+
+    if (!output.is_open())
+    {
+        std::cerr << "Profiler::writeChromeTrace(), unable to open \"" << file << "\"." << std::endl;
+        return false;
+    }
+
+    // Prevent threads registering whilst we're iterating.
+    std::lock_guard<std::mutex> lock (m_mutex);
+
+    unsigned long   written { 0 },
+                    dropped { 0 };
+    bool            first   { true };
+
+    output << "{\"traceEvents\":[";
+
+    for (const auto& buffer : m_buffers)
+    {
+        std::lock_guard<std::mutex> bufferLock (buffer->mutex);
+
+        // Name the thread so each track is labelled in the viewer.
+        if (!buffer->name.empty())
+        {
+            output << (first ? "\n" : ",\n") << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << buffer->id << ",\"args\":{\"name\":";
+            writeJSONString (output, buffer->name.c_str());
+            output << "}}";
+
+            first = false;
+        }
+
+        // Complete events contain both the start and duration of a scope.
+        for (const auto& event : buffer->events)
+        {
+            output << (first ? "\n" : ",\n") << "{\"name\":";
+            writeJSONString (output, event.name);
+            output << ",\"cat\":\"badger\",\"ph\":\"X\",\"ts\":" << event.start << ",\"dur\":" << (event.end - event.start) << ",\"pid\":1,\"tid\":" << buffer->id << "}";
+
+            first = false;
+        }
+
+        written += static_cast<unsigned long> (buffer->events.size());
+        dropped += buffer->dropped;
+    }
+
+    output << "\n],\"displayTimeUnit\":\"ms\"}" << std::endl;
+
+    std::cout << "Profiler: wrote " << written << " scopes from " << m_buffers.size() << " threads to \"" << file << "\"";
+
+    if (dropped > 0)
+    {
+        std::cout << ", " << dropped << " scopes were dropped because the buffers were full";
+    }
+
+    std::cout << "." << std::endl;
+
+    return output.good();
+}
+
+
+void Profiler::clear()
+{
+    std::lock_guard<std::mutex> lock (m_mutex);
+
+    for (auto& buffer : m_buffers)
+    {
+        std::lock_guard<std::mutex> bufferLock (buffer->mutex);
+
+        buffer->events.clear();
+        buffer->dropped = 0;
+    }
+}
+
+#pragma endregion
+
+
+#pragma region Helper functions
+
+Profiler::ThreadBuffer& Profiler::threadBuffer()
+{
+    // Only the first scope on each thread needs to take the global lock.
+    if (!currentBuffer)
+    {
+        std::lock_guard<std::mutex> lock (m_mutex);
+
+        m_buffers.push_back (std::make_unique<ThreadBuffer>());
+
+        auto& buffer = *m_buffers.back();
+        buffer.id = static_cast<unsigned int> (m_buffers.size());
+        buffer.events.reserve (4096);
+
+        currentBuffer = &buffer;
+    }
+
+    return *static_cast<ThreadBuffer*> (currentBuffer);
+}
+
+#pragma endregion
+
+
+#endif // BADGER_PROFILING_ENABLED
\ No newline at end of file
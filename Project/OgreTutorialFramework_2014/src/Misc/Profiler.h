@@ -0,0 +1,159 @@
+#pragma once
+
+#ifndef _PROFILER_
+#define _PROFILER_
+
+
+// Profiling is compiled out of release builds unless explicitly requested by defining BADGER_PROFILING.
+#if !defined (NDEBUG) || defined (BADGER_PROFILING)
+    #define BADGER_PROFILING_ENABLED
+#endif
+
+
+#if defined (BADGER_PROFILING_ENABLED)
+
+
+// STL headers.
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+
+/// <summary>
+/// Collects timed scopes from every thread into per-thread buffers and writes them out in the Chrome trace_event format, which can be viewed
+/// as a flame chart in chrome://tracing. Use the PROFILE_* macros rather than the class directly so that release builds contain no profiling.
+/// </summary>
+class Profiler final
+{
+    public:
+
+        #pragma region Constructors and destructor
+
+        Profiler();
+        ~Profiler();
+
+        Profiler (Profiler&& move)                  = delete;
+        Profiler& operator= (Profiler&& move)       = delete;
+        Profiler (const Profiler& copy)             = delete;
+        Profiler& operator= (const Profiler& copy)  = delete;
+
+        #pragma endregion
+
+        #pragma region Public interface
+
+        /// <summary> Gets the profiler used by the whole application. </summary>
+        static Profiler& instance();
+
+        /// <summary> Gets a timestamp in microseconds which is consistent across every thread. </summary>
+        long long now() const;
+
+        /// <summary> Records a completed scope for the calling thread. </summary>
+        /// <param name="name"> The name of the scope, this must be a string literal as only the pointer is kept. </param>
+        /// <param name="start"> The timestamp when the scope was entered. </param>
+        /// <param name="end"> The timestamp when the scope was exited. </param>
+        void record (const char* const name, const long long start, const long long end);
+
+        /// <summary> Names the calling thread in the trace output. </summary>
+        /// <param name="name"> The name to display, e.g. "Simulation". </param>
+        void setThreadName (const std::string& name);
+
+        /// <summary> Writes every recorded scope from every thread to a Chrome trace file, recording continues afterwards. </summary>
+        /// <param name="file"> The location of the JSON file to write. </param>
+        /// <returns> Whether the file was written successfully. </returns>
+        bool writeChromeTrace (const std::string& file);
+
+        /// <summary> Discards every recorded scope. </summary>
+        void clear();
+
+        #pragma endregion
+
+    private:
+
+        /// <summary>
+        /// The scopes recorded by a single thread. Only the owning thread writes to it so the lock is uncontended except when writing a trace.
+        /// </summary>
+        struct ThreadBuffer final
+        {
+            /// <summary> A single completed scope. </summary>
+            struct Event final
+            {
+                const char* name    { nullptr };    //!< The string literal given to the scope.
+                long long   start   { 0 };          //!< When the scope was entered in microseconds.
+                long long   end     { 0 };          //!< When the scope was exited in microseconds.
+            };
+
+            std::mutex          mutex       {  };       //!< Guards the events whilst a trace is being written.
+            std::vector<Event>  events      {  };       //!< Every scope recorded by the thread.
+            std::string         name        {  };       //!< The display name of the thread.
+            unsigned int        id          { 0 };      //!< A small unique number identifying the thread in the trace.
+            unsigned long       dropped     { 0 };      //!< How many scopes were discarded because the buffer was full.
+        };
+
+        #pragma region Helper functions
+
+        /// <summary> Gets the buffer of the calling thread, creating it upon first use. </summary>
+        ThreadBuffer& threadBuffer();
+
+        #pragma endregion
+
+        #pragma region Implementation data
+
+        std::mutex                                  m_mutex     {  };       //!< Guards the list of buffers.
+        std::vector<std::unique_ptr<ThreadBuffer>>  m_buffers   {  };       //!< The buffer of every thread which has recorded a scope.
+        long long                                   m_frequency { 0 };      //!< The number of clock ticks per second.
+        long long                                   m_epoch     { 0 };      //!< The clock value when the profiler was created, timestamps are relative to this.
+
+        #pragma endregion
+
+};
+
+
+/// <summary>
+/// Times the scope it is declared in and records it with the Profiler upon destruction.
+/// </summary>
+class ScopedTimer final
+{
+    public:
+
+        /// <summary> Starts timing immediately. </summary>
+        /// <param name="name"> The name of the scope, this must be a string literal as only the pointer is kept. </param>
+        explicit ScopedTimer (const char* const name)
+            : m_name (name), m_start (Profiler::instance().now()) { }
+
+        ~ScopedTimer()                                      { Profiler::instance().record (m_name, m_start, Profiler::instance().now()); }
+
+        ScopedTimer (ScopedTimer&& move)                    = delete;
+        ScopedTimer& operator= (ScopedTimer&& move)         = delete;
+        ScopedTimer (const ScopedTimer& copy)               = delete;
+        ScopedTimer& operator= (const ScopedTimer& copy)    = delete;
+
+    private:
+
+        const char* m_name  { nullptr };    //!< The name of the scope.
+        long long   m_start { 0 };          //!< When the scope was entered in microseconds.
+};
+
+
+// The line number keeps each timer unique so multiple scopes can be profiled in one function.
+#define PROFILE_JOIN_IMPL(a, b)         a##b
+#define PROFILE_JOIN(a, b)              PROFILE_JOIN_IMPL (a, b)
+
+#define PROFILE_SCOPE(name)             ScopedTimer PROFILE_JOIN (profileScope, __LINE__) (name)
+#define PROFILE_FUNCTION()              PROFILE_SCOPE (__FUNCTION__)
+#define PROFILE_THREAD_NAME(name)       Profiler::instance().setThreadName (name)
+#define PROFILE_DUMP(file)              Profiler::instance().writeChromeTrace (file)
+
+
+#else
+
+
+#define PROFILE_SCOPE(name)
+#define PROFILE_FUNCTION()
+#define PROFILE_THREAD_NAME(name)
+#define PROFILE_DUMP(file)
+
+
+#endif // BADGER_PROFILING_ENABLED
+
+#endif // _PROFILER_
\ No newline at end of file
@@ -0,0 +1,154 @@
+#include "RollingHistogram.h"
+
+
+
+// STL headers.
+#include <algorithm>
+#include <cmath>
+
+
+
+// Engine headers.
+#include <Utility/Maths.h>
+
+
+
+#pragma region Constructors and destructor
+
+RollingHistogram::RollingHistogram (const double bucketWidth, const unsigned int bucketCount, const unsigned int windowSize)
+    : m_bucketWidth (bucketWidth > 0.0 ? bucketWidth : 0.1)
+{
+    // We always need somewhere to put a sample.
+    m_buckets.resize (util::max (bucketCount, 1U) + 1, 0);
+    m_samples.resize (util::max (windowSize, 1U), 0.0);
+}
+
+
+RollingHistogram::RollingHistogram (RollingHistogram&& move)
+{
+    *this = std::move (move);
+}
+
+
+RollingHistogram& RollingHistogram::operator= (RollingHistogram&& move)
+{
+    if (this != &move)
+    {
+        // RollingHistogram.
+        m_bucketWidth = std::move (move.m_bucketWidth);
+        m_buckets = std::move (move.m_buckets);
+        m_samples = std::move (move.m_samples);
+        m_next = std::move (move.m_next);
+        m_count = std::move (move.m_count);
+        m_sum = std::move (move.m_sum);
+    }
+
+    return *this;
+}
+
+#pragma endregion
+
+
+#pragma region Getters and setters
+
+double RollingHistogram::getMax() const
+{
+    // The window is small enough that scanning it is cheaper than maintaining a sorted structure on every add.
+    double maximum { 0.0 };
+
+    for (unsigned int i = 0; i < m_count; ++i)
+    {
+        maximum = util::max (maximum, m_samples[i]);
+    }
+
+    return maximum;
+}
+
+
+double RollingHistogram::percentile (const double percent) const
+{
+    // Pre-condition: We have samples.
+    if (m_count == 0)
+    {
+        return 0.0;
+    }
+
+    // Find the number of samples which must be at or below the result.
+    const double        clamped     { util::clamp (percent, 0.0, 100.0) };
+    const unsigned int  target      { util::max (static_cast<unsigned int> (std::ceil (clamped / 100.0 * m_count)), 1U) };
+    const unsigned int  overflow    { static_cast<unsigned int> (m_buckets.size()) - 1 };
+
+    unsigned int        cumulative  { 0 };
+
+    for (unsigned int i = 0; i < overflow; ++i)
+    {
+        cumulative += m_buckets[i];
+
+        if (cumulative >= target)
+        {
+            // Whole number widths hold whole number samples exactly at their lower edge, e.g. sub-steps, otherwise the midpoint is the best
+            // estimate. Never report more than was actually seen.
+            const double offset { m_bucketWidth == std::floor (m_bucketWidth) ? 0.0 : 0.5 };
+
+            return util::min ((i + offset) * m_bucketWidth, getMax());
+        }
+    }
+
+    // The percentile lies beyond the range of the histogram.
+    return getMax();
+}
+
+#pragma endregion
+
+
+#pragma region Public interface
+
+void RollingHistogram::add (const double value)
+{
+    const double sample { util::max (value, 0.0) };
+
+    // Evict the oldest sample when the window is full.
+    if (m_count == m_samples.size())
+    {
+        const double oldest { m_samples[m_next] };
+
+        --m_buckets[bucketOf (oldest)];
+        m_sum -= oldest;
+    }
+
+    else
+    {
+        ++m_count;
+    }
+
+    m_samples[m_next] = sample;
+    m_next = (m_next + 1) % m_samples.size();
+
+    ++m_buckets[bucketOf (sample)];
+    m_sum += sample;
+}
+
+
+void RollingHistogram::clear()
+{
+    std::fill (m_buckets.begin(), m_buckets.end(), 0);
+
+    m_next = 0;
+    m_count = 0;
+    m_sum = 0.0;
+}
+
+#pragma endregion
+
+
+#pragma region Helper functions
+
+unsigned int RollingHistogram::bucketOf (const double value) const
+{
+    const unsigned int  overflow    { static_cast<unsigned int> (m_buckets.size()) - 1 };
+    const double        bucket      { value / m_bucketWidth };
+
+    return bucket >= overflow ? overflow : static_cast<unsigned int> (bucket);
+}
+
+#pragma endregion
\ No newline at end of file
@@ -0,0 +1,90 @@
+#pragma once
+
+#ifndef _ROLLING_HISTOGRAM_
+#define _ROLLING_HISTOGRAM_
+
+
+// STL headers.
+#include <vector>
+
+
+/// <summary>
+/// A fixed-width bucket histogram over the most recent samples. Old samples leave the histogram as new ones arrive so percentiles always
+/// describe the recent past, and querying them costs the same regardless of how many samples have been added.
+/// </summary>
+class RollingHistogram final
+{
+    public:
+
+        #pragma region Constructors and destructor
+
+        /// <summary> Creates an empty histogram. </summary>
+        /// <param name="bucketWidth"> The range of values covered by each bucket, this is the precision of each percentile. </param>
+        /// <param name="bucketCount"> The number of buckets, values beyond the final bucket are still counted and reported as the maximum. </param>
+        /// <param name="windowSize"> How many of the most recent samples are kept. </param>
+        RollingHistogram (const double bucketWidth = 0.1, const unsigned int bucketCount = 1000, const unsigned int windowSize = 1000);
+
+        RollingHistogram (RollingHistogram&& move);
+        RollingHistogram& operator= (RollingHistogram&& move);
+
+        RollingHistogram (const RollingHistogram& copy)             = default;
+        RollingHistogram& operator= (const RollingHistogram& copy)  = default;
+
+        ~RollingHistogram()                                         = default;
+
+        #pragma endregion
+
+        #pragma region Getters and setters
+
+        /// <summary> Gets how many samples are currently in the window. </summary>
+        unsigned int getCount() const   { return m_count; }
+
+        /// <summary> Gets the mean of the samples in the window. </summary>
+        double getMean() const          { return m_count == 0 ? 0.0 : m_sum / m_count; }
+
+        /// <summary> Gets the largest sample in the window. </summary>
+        double getMax() const;
+
+        /// <summary>
+        /// Gets the value which the given percentage of samples are less than or equal to. This is the lower edge of the bucket for whole number
+        /// bucket widths, so whole number samples are reported exactly, otherwise it's the middle of the bucket.
+        /// </summary>
+        /// <param name="percent"> The percentile to calculate, between 0.0 and 100.0. </param>
+        double percentile (const double percent) const;
+
+        #pragma endregion
+
+        #pragma region Public interface
+
+        /// <summary> Adds a sample, removing the oldest sample if the window is full. </summary>
+        /// <param name="value"> The value to add, negative values are treated as zero. </param>
+        void add (const double value);
+
+        /// <summary> Removes every sample. </summary>
+        void clear();
+
+        #pragma endregion
+
+    private:
+
+        #pragma region Helper functions
+
+        /// <summary> Finds the bucket a value belongs to, the final bucket holds every value beyond the range. </summary>
+        unsigned int bucketOf (const double value) const;
+
+        #pragma endregion
+
+        #pragma region Implementation data
+
+        double                      m_bucketWidth   { 0.1 };    //!< The range of values covered by each bucket.
+        std::vector<unsigned int>   m_buckets       {  };       //!< The number of samples in each bucket, including an overflow bucket.
+        std::vector<double>         m_samples       {  };       //!< A ring buffer of the samples in the window.
+        unsigned int                m_next          { 0 };      //!< The index in the ring buffer of the next sample.
+        unsigned int                m_count         { 0 };      //!< How many samples are in the window.
+        double                      m_sum           { 0.0 };    //!< The sum of every sample in the window.
+
+        #pragma endregion
+
+};
+
+#endif // _ROLLING_HISTOGRAM_
\ No newline at end of file
@@ -0,0 +1,120 @@
+#pragma once
+
+#ifndef _SPSC_QUEUE_
+#define _SPSC_QUEUE_
+
+
+// STL headers.
+#include <atomic>
+#include <cstddef>
+#include <vector>
+
+
+/// <summary>
+/// A fixed capacity, lock-free queue for exactly one producer thread and one consumer thread. The producer and consumer may be the same
+/// thread. Nothing is allocated after construction, when the queue is full new values are rejected rather than overwriting old ones.
+/// </summary>
+template <typename T> class SPSCQueue final
+{
+    public:
+
+        #pragma region Constructors and destructor
+
+        /// <summary> Creates an empty queue. </summary>
+        /// <param name="capacity"> The minimum number of values which can be queued, it is rounded up to a power of two. </param>
+        explicit SPSCQueue (const std::size_t capacity = 1024)
+        {
+            std::size_t size { 1 };
+
+            while (size < capacity)
+            {
+                size <<= 1;
+            }
+
+            m_values.resize (size);
+            m_mask = size - 1;
+        }
+
+        ~SPSCQueue()                                    = default;
+
+        // Atomics can't be moved or copied.
+        SPSCQueue (SPSCQueue&& move)                    = delete;
+        SPSCQueue& operator= (SPSCQueue&& move)         = delete;
+        SPSCQueue (const SPSCQueue& copy)               = delete;
+        SPSCQueue& operator= (const SPSCQueue& copy)    = delete;
+
+        #pragma endregion
+
+        #pragma region Getters and setters
+
+        /// <summary> Gets how many values can be queued at once. </summary>
+        std::size_t getCapacity() const     { return m_values.size(); }
+
+        /// <summary> Checks whether the queue is empty, this is only accurate when called by the consumer. </summary>
+        bool isEmpty() const                { return m_head.load (std::memory_order_relaxed) == m_tail.load (std::memory_order_acquire); }
+
+        #pragma endregion
+
+        #pragma region Producer interface
+
+        /// <summary> Adds a value to the back of the queue, this must only be called by the producer. </summary>
+        /// <returns> Whether there was room for the value. </returns>
+        bool push (const T& value)
+        {
+            const std::size_t tail { m_tail.load (std::memory_order_relaxed) };
+
+            if (tail - m_head.load (std::memory_order_acquire) == m_values.size())
+            {
+                return false;
+            }
+
+            m_values[tail & m_mask] = value;
+
+            // Release the value to the consumer.
+            m_tail.store (tail + 1, std::memory_order_release);
+            return true;
+        }
+
+        #pragma endregion
+
+        #pragma region Consumer interface
+
+        /// <summary> Removes the value at the front of the queue, this must only be called by the consumer. </summary>
+        /// <param name="value"> Receives the value if there was one. </param>
+        /// <returns> Whether a value was removed. </returns>
+        bool pop (T& value)
+        {
+            const std::size_t head { m_head.load (std::memory_order_relaxed) };
+
+            if (head == m_tail.load (std::memory_order_acquire))
+            {
+                return false;
+            }
+
+            value = m_values[head & m_mask];
+
+            // Return the slot to the producer.
+            m_head.store (head + 1, std::memory_order_release);
+            return true;
+        }
+
+        #pragma endregion
+
+    private:
+
+        #pragma region Implementation data
+
+        std::vector<T>              m_values        {  };   //!< The ring buffer of queued values.
+        std::size_t                 m_mask          { 0 };  //!< Converts a position into an index in the ring buffer.
+
+        // The positions are written by different threads so they're kept on separate cache lines.
+        char                        m_padding0[64];         //!< Separates the read-only data from the consumer position.
+        std::atomic<std::size_t>    m_head          { 0 };  //!< The position of the next value to pop, only written by the consumer.
+        char                        m_padding1[64];         //!< Separates the consumer position from the producer position.
+        std::atomic<std::size_t>    m_tail          { 0 };  //!< The position of the next value to push, only written by the producer.
+
+        #pragma endregion
+
+};
+
+#endif // _SPSC_QUEUE_
\ No newline at end of file
@@ -0,0 +1,128 @@
+#include "SpatialHash.h"
+
+
+
+// STL headers.
+#include <algorithm>
+
+
+
+#pragma region Constructors and destructor
+
+SpatialHash::SpatialHash (const float cellSize)
+{
+    setCellSize (cellSize);
+}
+
+
+SpatialHash::SpatialHash (SpatialHash&& move)
+{
+    *this = std::move (move);
+}
+
+
+SpatialHash& SpatialHash::operator= (SpatialHash&& move)
+{
+    if (this != &move)
+    {
+        m_cellSize = move.m_cellSize;
+        m_inverseCellSize = move.m_inverseCellSize;
+        m_mask = move.m_mask;
+
+        m_slotStart = std::move (move.m_slotStart);
+        m_indices = std::move (move.m_indices);
+        m_x = std::move (move.m_x);
+        m_z = std::move (move.m_z);
+        m_cellX = std::move (move.m_cellX);
+        m_cellZ = std::move (move.m_cellZ);
+        m_slots = std::move (move.m_slots);
+
+        move.m_mask = 0;
+    }
+
+    return *this;
+}
+
+#pragma endregion
+
+
+#pragma region Getters and setters
+
+void SpatialHash::setCellSize (const float cellSize)
+{
+    if (cellSize > 0.f)
+    {
+        m_cellSize = cellSize;
+        m_inverseCellSize = 1.f / cellSize;
+    }
+}
+
+#pragma endregion
+
+
+#pragma region Grid functionality
+
+void SpatialHash::build (const float* const x, const float* const z, const std::size_t count)
+{
+    // Two slots per point keeps collisions rare without the table dwarfing the points.
+    std::size_t slotCount { 1 };
+
+    while (slotCount < count * 2)
+    {
+        slotCount <<= 1;
+    }
+
+    m_mask = slotCount - 1;
+
+    // Count the points in each slot, offset by one so the prefix sum gives the start of each slot.
+    m_slotStart.assign (slotCount + 1, 0);
+    m_slots.resize (count);
+
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        m_slots[i] = slotOf (cellOf (x[i]), cellOf (z[i]));
+        ++m_slotStart[m_slots[i] + 1];
+    }
+
+    for (std::size_t slot = 0; slot < slotCount; ++slot)
+    {
+        m_slotStart[slot + 1] += m_slotStart[slot];
+    }
+
+    // Scatter each point into its slot, the slot starts are used as write positions and restored afterwards.
+    m_indices.resize (count);
+    m_x.resize (count);
+    m_z.resize (count);
+    m_cellX.resize (count);
+    m_cellZ.resize (count);
+
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        const std::size_t position { m_slotStart[m_slots[i]]++ };
+
+        m_indices[position] = i;
+        m_x[position] = x[i];
+        m_z[position] = z[i];
+        m_cellX[position] = cellOf (x[i]);
+        m_cellZ[position] = cellOf (z[i]);
+    }
+
+    // Every start has moved to the start of the next slot.
+    std::copy_backward (m_slotStart.begin(), m_slotStart.end() - 1, m_slotStart.end());
+    m_slotStart[0] = 0;
+}
+
+
+std::size_t SpatialHash::query (const float x, const float z, const float radius, std::vector<std::size_t>& neighbours) const
+{
+    const std::size_t before { neighbours.size() };
+
+    forEachNeighbour (x, z, radius, [&] (const std::size_t index, const float, const float)
+    {
+        neighbours.push_back (index);
+    });
+
+    return neighbours.size() - before;
+}
+
+#pragma endregion
\ No newline at end of file
@@ -0,0 +1,148 @@
+#pragma once
+
+#ifndef _SPATIAL_HASH_
+#define _SPATIAL_HASH_
+
+
+// STL headers.
+#include <cmath>
+#include <cstddef>
+#include <vector>
+
+
+/// <summary>
+/// A uniform grid over points on the ground plane, where each cell is hashed into a table with two slots per point so the world
+/// doesn't need bounds. The grid is rebuilt from scratch with a counting sort, which is linear in the number of points, and every point is
+/// copied so that the points of each cell are contiguous. A query only visits the cells its radius overlaps, so finding the neighbours of
+/// every point is linear too as long as the cells are roughly the size of the query radius.
+/// </summary>
+class SpatialHash final
+{
+    public:
+
+        #pragma region Constructors and destructor
+
+        /// <summary> Creates an empty grid. </summary>
+        /// <param name="cellSize"> The width of each cell, ideally the radius most queries will use. </param>
+        explicit SpatialHash (const float cellSize = 50.f);
+
+        SpatialHash (SpatialHash&& move);
+        SpatialHash& operator= (SpatialHash&& move);
+
+        ~SpatialHash()                                  = default;
+
+        SpatialHash (const SpatialHash& copy)           = delete;
+        SpatialHash& operator= (const SpatialHash& copy) = delete;
+
+        #pragma endregion
+
+        #pragma region Getters and setters
+
+        /// <summary> Gets the number of points in the grid. </summary>
+        std::size_t getCount() const                    { return m_indices.size(); }
+
+        float getCellSize() const                       { return m_cellSize; }
+
+        /// <summary> Sets the width of each cell, this only takes effect when the grid is next built. </summary>
+        /// <param name="cellSize"> Must be greater than zero, otherwise the current size is kept. </param>
+        void setCellSize (const float cellSize);
+
+        #pragma endregion
+
+        #pragma region Grid functionality
+
+        /// <summary> Replaces every point in the grid. </summary>
+        /// <param name="x"> The position of each point on the x axis. </param>
+        /// <param name="z"> The position of each point on the z axis. </param>
+        /// <param name="count"> How many points there are, each point is identified by its index. </param>
+        void build (const float* const x, const float* const z, const std::size_t count);
+
+        /// <summary> Calls a function for every point within a radius of a position, including a point at the position itself. </summary>
+        /// <param name="function"> Called with the index of the point and its offset from the position on the x and z axis. </param>
+        template <typename Function> void forEachNeighbour (const float x, const float z, const float radius, Function function) const;
+
+        /// <summary> Finds every point within a radius of a position. </summary>
+        /// <param name="neighbours"> The index of each point found is appended to this. </param>
+        /// <returns> How many points were found. </returns>
+        std::size_t query (const float x, const float z, const float radius, std::vector<std::size_t>& neighbours) const;
+
+        #pragma endregion
+
+    private:
+
+        #pragma region Helper functions
+
+        /// <summary> Gets the cell containing a coordinate on either axis. </summary>
+        int cellOf (const float coordinate) const       { return static_cast<int> (std::floor (coordinate * m_inverseCellSize)); }
+
+        /// <summary> Gets the slot of a cell in the table. Different cells can share a slot so points are also compared by their cell. </summary>
+        std::size_t slotOf (const int cellX, const int cellZ) const
+        {
+            return (static_cast<std::size_t> (cellX) * 73856093u ^ static_cast<std::size_t> (cellZ) * 19349663u) & m_mask;
+        }
+
+        #pragma endregion
+
+        #pragma region Implementation data
+
+        float                       m_cellSize          { 50.f };       //!< The width of each cell.
+        float                       m_inverseCellSize   { 1.f / 50.f }; //!< Avoids a division per coordinate.
+        std::size_t                 m_mask              { 0 };          //!< Converts a hash into a slot, the table size is a power of two.
+
+        std::vector<std::size_t>    m_slotStart         {  };   //!< Where the points of each slot begin, with an extra entry marking the end.
+        std::vector<std::size_t>    m_indices           {  };   //!< The index of each point, sorted by slot.
+        std::vector<float>          m_x                 {  };   //!< The x position of each point, sorted by slot.
+        std::vector<float>          m_z                 {  };   //!< The z position of each point, sorted by slot.
+        std::vector<int>            m_cellX             {  };   //!< The cell of each point on the x axis, sorted by slot.
+        std::vector<int>            m_cellZ             {  };   //!< The cell of each point on the z axis, sorted by slot.
+        std::vector<std::size_t>    m_slots             {  };   //!< The slot of each point in its original order, reused whilst building.
+
+        #pragma endregion
+
+};
+
+
+#pragma region Template implementation
+
+template <typename Function> void SpatialHash::forEachNeighbour (const float x, const float z, const float radius, Function function) const
+{
+    if (m_indices.empty())
+    {
+        return;
+    }
+
+    const float radiusSquared   { radius * radius };
+    const int   minX            { cellOf (x - radius) },
+                maxX            { cellOf (x + radius) },
+                minZ            { cellOf (z - radius) },
+                maxZ            { cellOf (z + radius) };
+
+    for (int cellZ = minZ; cellZ <= maxZ; ++cellZ)
+    {
+        for (int cellX = minX; cellX <= maxX; ++cellX)
+        {
+            const std::size_t slot { slotOf (cellX, cellZ) };
+
+            for (std::size_t i = m_slotStart[slot]; i < m_slotStart[slot + 1]; ++i)
+            {
+                // Skipping points from other cells which share the slot means a point is never visited twice.
+                if (m_cellX[i] != cellX || m_cellZ[i] != cellZ)
+                {
+                    continue;
+                }
+
+                const float offsetX { m_x[i] - x },
+                            offsetZ { m_z[i] - z };
+
+                if (offsetX * offsetX + offsetZ * offsetZ <= radiusSquared)
+                {
+                    function (m_indices[i], offsetX, offsetZ);
+                }
+            }
+        }
+    }
+}
+
+#pragma endregion
+
+#endif // _SPATIAL_HASH_
\ No newline at end of file
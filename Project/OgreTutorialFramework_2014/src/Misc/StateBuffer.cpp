@@ -0,0 +1,110 @@
+#include "StateBuffer.h"
+
+
+
+// STL headers.
+#include <cstring>
+#include <stdexcept>
+
+
+
+#pragma region Constructors and destructor
+
+StateBuffer::StateBuffer (StateBuffer&& move)
+{
+    *this = std::move (move);
+}
+
+
+StateBuffer& StateBuffer::operator= (StateBuffer&& move)
+{
+    if (this != &move)
+    {
+        // StateBuffer.
+        m_data = std::move (move.m_data);
+        m_cursor = std::move (move.m_cursor);
+
+        move.m_cursor = 0;
+    }
+
+    return *this;
+}
+
+#pragma endregion
+
+
+#pragma region Public interface
+
+void StateBuffer::clear()
+{
+    m_data.clear();
+    m_cursor = 0;
+}
+
+
+void StateBuffer::write (const Ogre::Vector3& value)
+{
+    write (value.x);
+    write (value.y);
+    write (value.z);
+}
+
+
+void StateBuffer::write (const Ogre::Quaternion& value)
+{
+    write (value.w);
+    write (value.x);
+    write (value.y);
+    write (value.z);
+}
+
+
+void StateBuffer::read (Ogre::Vector3& value)
+{
+    read (value.x);
+    read (value.y);
+    read (value.z);
+}
+
+
+void StateBuffer::read (Ogre::Quaternion& value)
+{
+    read (value.w);
+    read (value.x);
+    read (value.y);
+    read (value.z);
+}
+
+#pragma endregion
+
+
+#pragma region Helper functions
+
+void StateBuffer::writeBytes (const void* const source, const std::size_t bytes)
+{
+    if (bytes > 0)
+    {
+        const auto start = m_data.size();
+
+        m_data.resize (start + bytes);
+        std::memcpy (&m_data[start], source, bytes);
+    }
+}
+
+
+void StateBuffer::readBytes (void* const destination, const std::size_t bytes)
+{
+    // Reading past the end means the state was written by something else or in a different order.
+    if (m_cursor + bytes > m_data.size())
+    {
+        throw std::out_of_range ("StateBuffer::readBytes(), attempt to read beyond the end of the buffer.");
+    }
+
+    if (bytes > 0)
+    {
+        std::memcpy (destination, &m_data[m_cursor], bytes);
+        m_cursor += bytes;
+    }
+}
+
+#pragma endregion
\ No newline at end of file
@@ -0,0 +1,123 @@
+#pragma once
+
+#ifndef _STATE_BUFFER_
+#define _STATE_BUFFER_
+
+
+// STL headers.
+#include <cstddef>
+#include <type_traits>
+#include <vector>
+
+
+/// <summary>
+/// A flat buffer of simulation state. Actors and simulators append their state in a fixed order and read it back in the same order, so
+/// restoring is a series of small copies rather than repeating the work of a reset. Only trivially copyable types may be stored, Ogre's vectors
+/// and quaternions define their own assignment so they're written component by component instead.
+/// </summary>
+class StateBuffer final
+{
+    public:
+
+        #pragma region Constructors and destructor
+
+        StateBuffer()                                       = default;
+
+        StateBuffer (StateBuffer&& move);
+        StateBuffer& operator= (StateBuffer&& move);
+
+        StateBuffer (const StateBuffer& copy)               = default;
+        StateBuffer& operator= (const StateBuffer& copy)    = default;
+
+        ~StateBuffer()                                      = default;
+
+        #pragma endregion
+
+        #pragma region Getters and setters
+
+        /// <summary> Gets the number of bytes stored. </summary>
+        std::size_t size() const    { return m_data.size(); }
+
+        /// <summary> Checks whether anything has been stored. </summary>
+        bool isEmpty() const        { return m_data.empty(); }
+
+        #pragma endregion
+
+        #pragma region Public interface
+
+        /// <summary> Removes everything stored, the memory is kept so capturing again doesn't allocate. </summary>
+        void clear();
+
+        /// <summary> Moves the read position back to the start so the state can be restored again. </summary>
+        void rewind()               { m_cursor = 0; }
+
+        /// <summary> Appends a value to the buffer. </summary>
+        template <typename T> void write (const T& value)
+        {
+            static_assert (std::is_trivially_copyable<T>::value, "StateBuffer::write(), only trivially copyable types can be stored.");
+            writeBytes (&value, sizeof (T));
+        }
+
+        /// <summary> Appends a vector to the buffer, preceded by its size. </summary>
+        template <typename T> void write (const std::vector<T>& values)
+        {
+            static_assert (std::is_trivially_copyable<T>::value, "StateBuffer::write(), only vectors of trivially copyable types can be stored.");
+            write (values.size());
+            writeBytes (values.data(), values.size() * sizeof (T));
+        }
+
+        /// <summary> Appends the components of a vector. </summary>
+        void write (const Ogre::Vector3& value);
+
+        /// <summary> Appends the components of a quaternion. </summary>
+        void write (const Ogre::Quaternion& value);
+
+        /// <summary> Reads the next value from the buffer. Throws std::out_of_range if the buffer doesn't contain enough data. </summary>
+        template <typename T> void read (T& value)
+        {
+            static_assert (std::is_trivially_copyable<T>::value, "StateBuffer::read(), only trivially copyable types can be stored.");
+            readBytes (&value, sizeof (T));
+        }
+
+        /// <summary> Reads a vector written with write(), reusing the memory of the given vector where possible. </summary>
+        template <typename T> void read (std::vector<T>& values)
+        {
+            static_assert (std::is_trivially_copyable<T>::value, "StateBuffer::read(), only vectors of trivially copyable types can be stored.");
+
+            std::size_t count { 0 };
+            read (count);
+
+            values.resize (count);
+            readBytes (values.data(), count * sizeof (T));
+        }
+
+        /// <summary> Reads the components of a vector written with write(). </summary>
+        void read (Ogre::Vector3& value);
+
+        /// <summary> Reads the components of a quaternion written with write(). </summary>
+        void read (Ogre::Quaternion& value);
+
+        #pragma endregion
+
+    private:
+
+        #pragma region Helper functions
+
+        /// <summary> Copies raw bytes onto the end of the buffer. </summary>
+        void writeBytes (const void* const source, const std::size_t bytes);
+
+        /// <summary> Copies raw bytes from the read position, advancing it. </summary>
+        void readBytes (void* const destination, const std::size_t bytes);
+
+        #pragma endregion
+
+        #pragma region Implementation data
+
+        std::vector<unsigned char>  m_data      {  };   //!< Every value written so far.
+        std::size_t                 m_cursor    { 0 };  //!< The position of the next value to read.
+
+        #pragma endregion
+
+};
+
+#endif // _STATE_BUFFER_
\ No newline at end of file
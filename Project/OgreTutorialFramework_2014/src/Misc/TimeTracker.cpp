@@ -2,11 +2,6 @@
 
 
 
-// STL headers.
-#include <cmath>
-
-
-
 // Engine headers.
 #include <Utility/Maths.h>
 
@@ -14,10 +9,12 @@
 
 #pragma region Constructors and destructor
 
-TimeTracker::TimeTracker (float min, float max) : m_min (min), m_max (max)
+TimeTracker::TimeTracker (TweenSystem& system, const float min, const float max, const float speed, const TweenSystem::Easing easing) 
+    : m_system (&system)
 {
     // Default to having the tracker go from min to max.
-    setValues (min, max, max, min);
+    m_handle = m_system->create (min, max, util::min (min, max), speed, easing);
+    m_system->setTarget (m_handle, util::max (min, max));
 }
 
 
@@ -31,18 +28,32 @@ TimeTracker& TimeTracker::operator= (TimeTracker&& move)
 {
     if (this != &move)
     {
+        // Release our own tween before taking ownership.
+        if (m_system)
+        {
+            m_system->destroy (m_handle);
+        }
+
         // TimeTracker.
-        m_min = std::move (move.m_min);
-        m_max = std::move (move.m_max);
-        m_current = std::move (move.m_current);
-        m_target = std::move (move.m_target);
+        m_system = move.m_system;
+        m_handle = move.m_handle;
 
-        m_isAscending = std::move (move.m_isAscending);
+        move.m_system = nullptr;
+        move.m_handle = TweenSystem::Handle();
     }
 
     return *this;
 }
 
+
+TimeTracker::~TimeTracker()
+{
+    if (m_system)
+    {
+        m_system->destroy (m_handle);
+    }
+}
+
 #pragma endregion
 
 
@@ -50,92 +61,84 @@ TimeTracker& TimeTracker::operator= (TimeTracker&& move)
 
 void TimeTracker::setMin (const float min)
 {
-    // Value must be positive and lower than max.
-    m_min = util::clamp (min, 0.f, m_max);
-    m_current = util::max (m_min, m_current);
-    m_target = util::max (m_min, m_target);
+    if (!m_system)
+    {
+        return;
+    }
+
+    // Value must be lower than max.
+    m_system->setRange (m_handle, util::min (min, getMax()), getMax());
 }
 
 
 void TimeTracker::setMax (const float max)
 {
+    if (!m_system)
+    {
+        return;
+    }
+
     // Value must be higher than the minimum.
-    m_max = util::max (max, m_min);
-    m_current = util::min (m_max, m_current);
-    m_target = util::min (m_max, m_target);
+    m_system->setRange (m_handle, getMin(), util::max (max, getMin()));
 }
 
 
 void TimeTracker::setCurrent (const float current)
 {
-    // Value must be between min and max.
-    m_current = util::clamp (current, m_min, m_max);
-    m_isAscending = m_target > m_current;
+    if (!m_system)
+    {
+        return;
+    }
+
+    m_system->setCurrent (m_handle, current);
 }
 
 
 void TimeTracker::setTarget (const float target)
 {
-    // Value must be between min and max.
-    m_target = util::clamp (target, m_min, m_max);
-    m_isAscending = m_target > m_current;
+    if (!m_system)
+    {
+        return;
+    }
+
+    m_system->setTarget (m_handle, target);
 }
 
 
 void TimeTracker::setNormalisedTarget (const float target)
 {
-    // Calculate the difference using a clamped target value.
-    const float difference  { (m_max - m_min) * util::clamp (target, 0.f, 1.f) };
+    if (!m_system)
+    {
+        return;
+    }
 
-    // Set the target as normal.
-    m_target = m_min + difference;
-    m_isAscending = m_target > m_current;
+    m_system->setNormalisedTarget (m_handle, target);
 }
 
 
 void TimeTracker::setValues (const float min, const float max)
 {
-    setValues (min, max, m_target);
+    setValues (min, max, getTarget());
 }
 
 
 void TimeTracker::setValues (const float min, const float max, const float target)
 {
-    setValues (min, max, target, m_current);
+    setValues (min, max, target, getCurrent());
 }
 
 
 void TimeTracker::setValues (const float min, const float max, const float target, const float current)
 {
-    // Ensure safety of all variables.
-    m_min = util::max (0.f, min);
-    m_max = util::max (0.f, max);
-
-    if (m_min > m_max)
+    if (!m_system)
     {
-        std::swap (m_min, m_max);
+        return;
     }
 
-    // m_min and m_max are now safe, clean up with m_target and m_current.
-    m_target = util::clamp (target, m_min, m_max);
-    m_current = util::clamp (current, m_min, m_max);
-    m_isAscending = m_target > m_current;
-}
-
-#pragma endregion
-
-
-#pragma region Tracking functionality
-
-void TimeTracker::updateTime (float deltaTime)
-{
-    // Ensure the deltaTime value is positive.
-    deltaTime = std::abs (deltaTime);
-
-    // Calculate the current value with the added deltaTime. Ensure we don't go past the target.
-    m_current = m_isAscending ? 
-                                util::min (m_current + deltaTime, m_target) :
-                                util::max (m_current - deltaTime, m_target);
+    // The system swaps min and max if necessary and clamps the target and current values.
+    m_system->setRange (m_handle, min, max);
+    m_system->setCurrent (m_handle, current);
+    m_system->setTarget (m_handle, target);
 }
 
 #pragma endregion
\ No newline at end of file
@@ -4,8 +4,13 @@
 #define _TIME_TRACKER_
 
 
+// Engine headers.
+#include <Misc/TweenSystem.h>
+
+
 /// <summary>
-/// A little helper class which can be used for keeping track of time. This can be very helpful for animation.
+/// A little helper class which can be used for keeping track of time. This can be very helpful for animation. Each tracker is a handle to a
+/// tween in a TweenSystem, so thousands of trackers are advanced together by TweenSystem::updateAll(). The system must outlive its trackers.
 /// </summary>
 class TimeTracker final
 {
@@ -14,34 +19,46 @@ class TimeTracker final
         #pragma region Constructors and destructor
         
         /// <summary> 
-        /// Allows the specifying of minimum and maximum values for the tracker. Values will be swapped if min is more than max. 
+        /// Creates a tween in the given system which goes from the minimum to the maximum. Values will be swapped if min is more than max. 
         /// </summary>
-        /// <param name="min"> The lowest accepted minimum is zero. </param>
-        /// <param name="max"> Any positive value is accepted provided it is >= 0.f </param>
-        TimeTracker (const float min, const float max);
+        /// <param name="system"> The TweenSystem which stores and updates the tracker. </param>
+        /// <param name="min"> The lowest value of the tracker. </param>
+        /// <param name="max"> The highest value of the tracker. </param>
+        /// <param name="speed"> How far the current value moves each second, 1.f tracks time in seconds. </param>
+        /// <param name="easing"> The curve followed between the current value and the target. </param>
+        TimeTracker (TweenSystem& system, const float min, const float max, const float speed = 1.f, 
+                     const TweenSystem::Easing easing = TweenSystem::Easing::Linear);
 
         TimeTracker (TimeTracker&& move);
         TimeTracker& operator= (TimeTracker&& move);
         
+        /// <summary> Destroys the tween of the tracker. </summary>
+        ~TimeTracker();
+
+        /// <summary> Creates an empty tracker, it reads as zero and ignores every setter until another tracker is moved into it. </summary>
         TimeTracker()                                       = default;
-        TimeTracker (const TimeTracker& copy)               = default;
-        TimeTracker& operator= (const TimeTracker& copy)    = default;
-        ~TimeTracker()                                      = default;
+
+        TimeTracker (const TimeTracker& copy)               = delete;
+        TimeTracker& operator= (const TimeTracker& copy)    = delete;
 
         #pragma endregion
 
         #pragma region Getters and setters
 
+        /// <summary> Indicates whether the tracker refers to a tween, default constructed and moved trackers don't. </summary>
+        bool isValid() const        { return m_system && m_system->isValid (m_handle); }
+
         /// <summary> Indicates whether the tracker is reducing or increasing the current time value. </summary>
-        bool isAscending() const    { return m_isAscending; }
+        bool isAscending() const    { return m_system && m_system->isAscending (m_handle); }
 
         /// <summary> Indicates whether the tracker has reached the target time. </summary>
-        bool isFinished() const     { return m_current == m_target; }
+        bool isFinished() const     { return m_system && m_system->isFinished (m_handle); }
         
-        float getMin() const        { return m_min; }
-        float getMax() const        { return m_max; }
-        float getCurrent() const    { return m_current; }
-        float getTarget() const     { return m_target; }
+        // Empty trackers read as zero and ignore every setter, the same as a destroyed tween.
+        float getMin() const        { return m_system ? m_system->getMin (m_handle) : 0.f; }
+        float getMax() const        { return m_system ? m_system->getMax (m_handle) : 0.f; }
+        float getCurrent() const    { return m_system ? m_system->getCurrent (m_handle) : 0.f; }
+        float getTarget() const     { return m_system ? m_system->getTarget (m_handle) : 0.f; }
 
         void setMin (const float min);
         void setMax (const float max);
@@ -56,44 +73,36 @@ class TimeTracker final
         void setNormalisedTarget (const float target);
 
         /// <summary> Sets the current value to the neutral position (between min and max). </summary>
-        void setToNeutral()         { m_current = neutral(); }
+        void setToNeutral()         { setCurrent (neutral()); }
 
         /// <summary> Sets the current value to the minimum value. </summary>
-        void setToMin()             { m_current = m_min; }
+        void setToMin()             { setCurrent (getMin()); }
 
         /// <summary> Sets the current value to the maximum value. </summary>
-        void setToMax()             { m_current = m_max;}
+        void setToMax()             { setCurrent (getMax()); }
 
         /// <summary> Sets the current value to the target value. </summary>
-        void setToTarget()          { m_current = m_target; }
+        void setToTarget()          { setCurrent (getTarget()); }
 
         #pragma endregion
 
         #pragma region Tracking functionality
 
         /// <summary> Calculates the point between the minimum and maximum values. </summary>
-        float neutral() const           { return (m_min + m_max) / 2.f; }
+        float neutral() const           { return (getMin() + getMax()) / 2.f; }
 
         /// <summary> Calculates the current progress of the TimeTracker as a percentage. </summary>
-        float normalisedCurrent() const { return (m_current - m_min) / (m_max - m_min); }
+        float normalisedCurrent() const { return (getCurrent() - getMin()) / (getMax() - getMin()); }
 
         /// <summary> Calculates the target of the TimeTracker as a percentage of the min and max values given. </summary>
-        float normalisedTarget() const  { return (m_target - m_min) / (m_max - m_min); }
-
-        /// <summary> Updates the current time value based on the given deltaTime value. </summary>
-        void updateTime (float deltaTime);
+        float normalisedTarget() const  { return (getTarget() - getMin()) / (getMax() - getMin()); }
 
         #pragma endregion
 
     private:
 
-        float   m_min           { 0.f };    //!< The minimum time value.
-        float   m_max           { 0.f };    //!< The maximum time value.
-
-        float   m_current       { 0.f };    //!< The current time value.
-        float   m_target        { 0.f };    //!< The target point for the TimeTracker to aim for.
-
-        bool    m_isAscending   { true };   //!< A flag to indicate whether the TimeTracker should be increasing or decreasing.
+        TweenSystem*        m_system    { nullptr };    //!< The system storing the tween, a nullptr when the tracker is empty.
+        TweenSystem::Handle m_handle    {  };           //!< The tween which holds every value of the tracker.
 };
 
 
@@ -0,0 +1,79 @@
+#include "TransformBuffer.h"
+
+
+
+// Globals.
+const unsigned int freshBit     { 4 };      //!< Set alongside the pending index when the pending buffer contains an unread snapshot.
+const unsigned int indexMask    { 3 };      //!< Extracts the buffer index from the pending value.
+
+
+
+#pragma region TransformSnapshot
+
+void TransformSnapshot::apply (const float alpha) const
+{
+    for (const auto& transform : transforms)
+    {
+        const auto  position    = transform.previousPosition + (transform.position - transform.previousPosition) * alpha;
+        const auto  orientation = Ogre::Quaternion::nlerp (alpha, transform.previousOrientation, transform.orientation, true);
+
+        if (transform.node)
+        {
+            transform.node->setPosition (position);
+            transform.node->setOrientation (orientation);
+            transform.node->setScale (transform.scale);
+        }
+
+        // Instances rebuild their transform whenever it changes so only the final setter updates it.
+        else
+        {
+            transform.instance->setPosition (position, false);
+            transform.instance->setScale (transform.scale, false);
+            transform.instance->setOrientation (orientation);
+        }
+    }
+}
+
+#pragma endregion
+
+
+#pragma region Writer interface
+
+TransformSnapshot& TransformBuffer::beginWrite()
+{
+    auto& snapshot = m_buffers[m_back];
+    snapshot.transforms.clear();
+
+    return snapshot;
+}
+
+
+void TransformBuffer::publish()
+{
+    // Swap the back buffer with the pending buffer, the reader may have left us the old front buffer instead.
+    m_back = m_pending.exchange (m_back | freshBit) & indexMask;
+}
+
+#pragma endregion
+
+
+#pragma region Reader interface
+
+const TransformSnapshot& TransformBuffer::acquire()
+{
+    // Only swap when something new exists, otherwise we'd give the writer the snapshot we're displaying.
+    if (hasNewSnapshot())
+    {
+        m_front = m_pending.exchange (m_front) & indexMask;
+    }
+
+    return m_buffers[m_front];
+}
+
+
+bool TransformBuffer::hasNewSnapshot() const
+{
+    return (m_pending.load() & freshBit) != 0;
+}
+
+#pragma endregion
\ No newline at end of file
@@ -0,0 +1,98 @@
+#pragma once
+
+#ifndef _TRANSFORM_BUFFER_
+#define _TRANSFORM_BUFFER_
+
+
+// STL headers.
+#include <atomic>
+#include <vector>
+
+
+/// <summary>
+/// The transform of a single SceneNode or instanced entity at the previous and current simulation step.
+/// </summary>
+struct ActorTransform final
+{
+    Ogre::SceneNode*        node                { nullptr };        //!< The SceneNode to apply the transform to.
+    Ogre::InstancedEntity*  instance            { nullptr };        //!< The instance to apply the transform to when there is no SceneNode.
+
+    Ogre::Vector3           previousPosition    {  };               //!< The position before the most recent step.
+    Ogre::Quaternion        previousOrientation {  };               //!< The orientation before the most recent step.
+
+    Ogre::Vector3           position            {  };               //!< The position after the most recent step.
+    Ogre::Quaternion        orientation         {  };               //!< The orientation after the most recent step.
+    Ogre::Vector3           scale               { 1.f, 1.f, 1.f };  //!< The scale after the most recent step.
+};
+
+
+/// <summary>
+/// Every transform published by the simulation after a single step.
+/// </summary>
+struct TransformSnapshot final
+{
+    std::vector<ActorTransform> transforms  {  };       //!< The transform of each simulated SceneNode or instance.
+    double                      time        { 0.0 };    //!< When the snapshot was published, in seconds. Used to interpolate between steps.
+    unsigned long               step        { 0 };      //!< The number of steps simulated when the snapshot was published.
+
+    /// <summary> Blends every transform and writes the result to each SceneNode or instance. This must only be called from the thread which renders. </summary>
+    /// <param name="alpha"> How far between the previous (0.f) and current (1.f) step to display each node. </param>
+    void apply (const float alpha) const;
+};
+
+
+/// <summary>
+/// A lock-free triple buffer of TransformSnapshot objects. A single writer fills the back buffer and publishes it whilst a single reader
+/// acquires the most recently published snapshot, neither thread ever waits for the other.
+/// </summary>
+class TransformBuffer final
+{
+    public:
+
+        #pragma region Constructors and destructor
+
+        TransformBuffer()                                       = default;
+        ~TransformBuffer()                                      = default;
+
+        TransformBuffer (TransformBuffer&& move)                = delete;
+        TransformBuffer& operator= (TransformBuffer&& move)     = delete;
+        TransformBuffer (const TransformBuffer& copy)           = delete;
+        TransformBuffer& operator= (const TransformBuffer& copy) = delete;
+
+        #pragma endregion
+
+        #pragma region Writer interface
+
+        /// <summary> Obtains the back buffer for writing, it is emptied beforehand but keeps its memory. </summary>
+        TransformSnapshot& beginWrite();
+
+        /// <summary> Makes the back buffer available to the reader, replacing any snapshot that hasn't been acquired yet. </summary>
+        void publish();
+
+        #pragma endregion
+
+        #pragma region Reader interface
+
+        /// <summary> Obtains the most recently published snapshot. </summary>
+        /// <returns> The latest snapshot, this is the same as the previous call if nothing new has been published. </returns>
+        const TransformSnapshot& acquire();
+
+        /// <summary> Checks whether a snapshot has been published since the last call to acquire(). </summary>
+        bool hasNewSnapshot() const;
+
+        #pragma endregion
+
+    private:
+
+        #pragma region Implementation data
+
+        TransformSnapshot           m_buffers[3]    {  };       //!< The back, pending and front snapshots, their roles are swapped rather than copying.
+        std::atomic<unsigned int>   m_pending       { 1 };      //!< The index of the pending buffer, the fresh bit is set when it hasn't been acquired.
+        unsigned int                m_back          { 0 };      //!< The index of the buffer being written, only accessed by the writer.
+        unsigned int                m_front         { 2 };      //!< The index of the buffer being read, only accessed by the reader.
+
+        #pragma endregion
+
+};
+
+#endif // _TRANSFORM_BUFFER_
\ No newline at end of file
@@ -0,0 +1,392 @@
+#include "TweenSystem.h"
+
+
+
+// STL headers.
+#include <cmath>
+#include <utility>
+
+
+
+// Engine headers.
+#include <Utility/Maths.h>
+#include <Utility/SIMD.h>
+
+
+
+// Globals.
+
+/// <summary> The coefficients of t^3, t^2 and t for each easing, indexed by TweenSystem::Easing. Each sums to one so t = 1 finishes. </summary>
+const float easingCoefficients[][3] { { 0.f, 0.f, 1.f },       // Linear: t.
+                                      { 0.f, 1.f, 0.f },       // QuadraticIn: t^2.
+                                      { 0.f, -1.f, 2.f },      // QuadraticOut: 1 - (1 - t)^2.
+                                      { 1.f, 0.f, 0.f },       // CubicIn: t^3.
+                                      { 1.f, -3.f, 3.f },      // CubicOut: 1 - (1 - t)^3.
+                                      { -2.f, 3.f, 0.f } };    // SmoothStep: 3t^2 - 2t^3.
+
+
+
+#pragma region Constructors and destructor
+
+TweenSystem::TweenSystem()
+{
+}
+
+
+TweenSystem::TweenSystem (TweenSystem&& move)
+{
+    *this = std::move (move);
+}
+
+
+TweenSystem& TweenSystem::operator= (TweenSystem&& move)
+{
+    if (this != &move)
+    {
+        m_from = std::move (move.m_from);
+        m_to = std::move (move.m_to);
+        m_progress = std::move (move.m_progress);
+        m_rate = std::move (move.m_rate);
+        m_cubic = std::move (move.m_cubic);
+        m_quadratic = std::move (move.m_quadratic);
+        m_linear = std::move (move.m_linear);
+        m_current = std::move (move.m_current);
+
+        m_min = std::move (move.m_min);
+        m_max = std::move (move.m_max);
+        m_speed = std::move (move.m_speed);
+        m_easing = std::move (move.m_easing);
+        m_generation = std::move (move.m_generation);
+        m_free = std::move (move.m_free);
+    }
+
+    return *this;
+}
+
+
+TweenSystem::~TweenSystem()
+{
+}
+
+#pragma endregion
+
+
+#pragma region Tween management
+
+TweenSystem::Handle TweenSystem::create (const float min, const float max, const float current, const float speed, const Easing easing)
+{
+    Handle handle {  };
+
+    // Reuse a destroyed slot before growing the arrays.
+    if (!m_free.empty())
+    {
+        handle.index = m_free.back();
+        m_free.pop_back();
+    }
+
+    else
+    {
+        handle.index = static_cast<std::uint32_t> (m_current.size());
+
+        m_from.push_back (0.f);
+        m_to.push_back (0.f);
+        m_progress.push_back (1.f);
+        m_rate.push_back (0.f);
+        m_cubic.push_back (0.f);
+        m_quadratic.push_back (0.f);
+        m_linear.push_back (1.f);
+        m_current.push_back (0.f);
+
+        m_min.push_back (0.f);
+        m_max.push_back (0.f);
+        m_speed.push_back (0.f);
+        m_easing.push_back (Easing::Linear);
+        m_generation.push_back (1);
+    }
+
+    handle.generation = m_generation[handle.index];
+
+    // A new tween has already reached its target.
+    const auto index = handle.index;
+
+    m_min[index] = util::min (min, max);
+    m_max[index] = util::max (min, max);
+    m_current[index] = util::clamp (current, m_min[index], m_max[index]);
+    m_to[index] = m_current[index];
+    m_speed[index] = util::max (speed, 0.f);
+
+    setEasing (handle, easing);
+    restart (index);
+
+    return handle;
+}
+
+
+void TweenSystem::destroy (const Handle handle)
+{
+    if (!isValid (handle))
+    {
+        return;
+    }
+
+    const auto index = handle.index;
+
+    // Zero marks an invalid handle so it's skipped if the generation wraps around.
+    if (++m_generation[index] == 0)
+    {
+        m_generation[index] = 1;
+    }
+
+    // The slot is still updated so leave it finished and stationary.
+    m_from[index] = m_to[index] = m_current[index] = 0.f;
+    m_progress[index] = 1.f;
+    m_rate[index] = 0.f;
+
+    m_free.push_back (index);
+}
+
+
+bool TweenSystem::isValid (const Handle handle) const
+{
+    return handle.generation != 0 && handle.index < m_generation.size() && m_generation[handle.index] == handle.generation;
+}
+
+#pragma endregion
+
+
+#pragma region Getters and setters
+
+void TweenSystem::setRange (const Handle handle, const float min, const float max)
+{
+    if (!isValid (handle))
+    {
+        return;
+    }
+
+    const auto index = handle.index;
+
+    m_min[index] = util::min (min, max);
+    m_max[index] = util::max (min, max);
+    m_current[index] = util::clamp (m_current[index], m_min[index], m_max[index]);
+    m_to[index] = util::clamp (m_to[index], m_min[index], m_max[index]);
+
+    restart (index);
+}
+
+
+void TweenSystem::setCurrent (const Handle handle, const float current)
+{
+    if (!isValid (handle))
+    {
+        return;
+    }
+
+    m_current[handle.index] = util::clamp (current, m_min[handle.index], m_max[handle.index]);
+    restart (handle.index);
+}
+
+
+void TweenSystem::setTarget (const Handle handle, const float target)
+{
+    if (!isValid (handle))
+    {
+        return;
+    }
+
+    m_to[handle.index] = util::clamp (target, m_min[handle.index], m_max[handle.index]);
+    restart (handle.index);
+}
+
+
+void TweenSystem::setNormalisedTarget (const Handle handle, const float target)
+{
+    if (!isValid (handle))
+    {
+        return;
+    }
+
+    const auto index = handle.index;
+
+    m_to[index] = m_min[index] + (m_max[index] - m_min[index]) * util::clamp (target, 0.f, 1.f);
+    restart (index);
+}
+
+
+void TweenSystem::setSpeed (const Handle handle, const float speed)
+{
+    if (!isValid (handle))
+    {
+        return;
+    }
+
+    m_speed[handle.index] = util::max (speed, 0.f);
+    restart (handle.index);
+}
+
+
+void TweenSystem::setEasing (const Handle handle, const Easing easing)
+{
+    if (!isValid (handle))
+    {
+        return;
+    }
+
+    const auto  index           = handle.index;
+    const auto& coefficients    = easingCoefficients[static_cast<std::size_t> (easing)];
+
+    m_easing[index] = easing;
+    m_cubic[index] = coefficients[0];
+    m_quadratic[index] = coefficients[1];
+    m_linear[index] = coefficients[2];
+}
+
+#pragma endregion
+
+
+#pragma region Updating
+
+void TweenSystem::updateAllScalar (const float deltaTime)
+{
+    updateRange (0, m_current.size(), deltaTime);
+}
+
+
+#if BADGER_SIMD
+
+void TweenSystem::updateAll (const float deltaTime)
+{
+    // Only whole groups of four are vectorised, the remainder is handled by the scalar loop.
+    const std::size_t   count       { m_current.size() },
+                        vectorCount { count & ~static_cast<std::size_t> (3) };
+
+    const __m128        one         { _mm_set1_ps (1.f) },
+                        delta       { _mm_set1_ps (deltaTime) };
+
+    for (std::size_t i = 0; i < vectorCount; i += 4)
+    {
+        const __m128    t           { _mm_min_ps (_mm_add_ps (_mm_loadu_ps (&m_progress[i]), _mm_mul_ps (_mm_loadu_ps (&m_rate[i]), delta)), one) },
+                        cubic       { _mm_mul_ps (_mm_loadu_ps (&m_cubic[i]), t) },
+                        quadratic   { _mm_mul_ps (_mm_add_ps (cubic, _mm_loadu_ps (&m_quadratic[i])), t) },
+                        eased       { _mm_mul_ps (_mm_add_ps (quadratic, _mm_loadu_ps (&m_linear[i])), t) },
+                        from        { _mm_mul_ps (_mm_loadu_ps (&m_from[i]), _mm_sub_ps (one, eased)) },
+                        to          { _mm_mul_ps (_mm_loadu_ps (&m_to[i]), eased) };
+
+        _mm_storeu_ps (&m_progress[i], t);
+        _mm_storeu_ps (&m_current[i], _mm_add_ps (from, to));
+    }
+
+    updateRange (vectorCount, count, deltaTime);
+}
+
+#else
+
+void TweenSystem::updateAll (const float deltaTime)
+{
+    updateAllScalar (deltaTime);
+}
+
+#endif
+
+
+bool TweenSystem::verifyUpdate()
+{
+    // Cover every easing in both directions at several speeds, including jumping straight to the target. An odd count makes sure the
+    // scalar remainder is exercised too.
+    const float         targets[]   { 0.f, 0.25f, 1.f, 0.6f };
+    const float         speeds[]    { 0.f, 0.5f, 1.f, 3.f, 10.f };
+    const std::size_t   easings     { sizeof (easingCoefficients) / sizeof (easingCoefficients[0]) };
+
+    TweenSystem scalar {  }, vectorised {  };
+
+    for (std::size_t easing = 0; easing < easings; ++easing)
+    {
+        for (const float speed : speeds)
+        {
+            for (const float start : targets)
+            {
+                for (auto system : { &scalar, &vectorised })
+                {
+                    system->create (0.f, 1.f, start, speed, static_cast<Easing> (easing));
+                }
+            }
+        }
+    }
+
+    for (auto system : { &scalar, &vectorised })
+    {
+        system->create (-1.f, 1.f, -1.f, 0.75f, Easing::SmoothStep);
+    }
+
+    // Change the targets part way through so tweens restart from wherever they've reached.
+    for (std::size_t round = 0; round < 4; ++round)
+    {
+        for (std::size_t i = 0; i < scalar.m_current.size(); ++i)
+        {
+            Handle handle {  };
+            handle.index = static_cast<std::uint32_t> (i);
+            handle.generation = scalar.m_generation[i];
+
+            const float target { targets[(i + round) % (sizeof (targets) / sizeof (targets[0]))] };
+
+            scalar.setTarget (handle, target);
+            vectorised.setTarget (handle, target);
+        }
+
+        for (const float deltaTime : simd::verificationSteps)
+        {
+            scalar.updateAllScalar (deltaTime);
+            vectorised.updateAll (deltaTime);
+
+            const std::size_t count { scalar.m_current.size() };
+
+            if (!simd::compare ("TweenSystem::verifyUpdate()", scalar.m_current.data(), vectorised.m_current.data(), count, 1e-5f) ||
+                !simd::compare ("TweenSystem::verifyUpdate()", scalar.m_progress.data(), vectorised.m_progress.data(), count, 1e-5f))
+            {
+                return false;
+            }
+        }
+    }
+
+    return true;
+}
+
+#pragma endregion
+
+
+#pragma region Helper functions
+
+void TweenSystem::restart (const std::uint32_t index)
+{
+    const float distance { std::abs (m_to[index] - m_current[index]) };
+
+    if (distance > 0.f && m_speed[index] > 0.f)
+    {
+        m_from[index] = m_current[index];
+        m_progress[index] = 0.f;
+        m_rate[index] = m_speed[index] / distance;
+    }
+
+    // Tweens without a speed jump straight to the target.
+    else
+    {
+        m_from[index] = m_current[index] = m_to[index];
+        m_progress[index] = 1.f;
+        m_rate[index] = 0.f;
+    }
+}
+
+
+void TweenSystem::updateRange (const std::size_t begin, const std::size_t end, const float deltaTime)
+{
+    for (std::size_t i = begin; i < end; ++i)
+    {
+        const float t       { util::min (m_progress[i] + m_rate[i] * deltaTime, 1.f) },
+                    eased   { ((m_cubic[i] * t + m_quadratic[i]) * t + m_linear[i]) * t };
+
+        // Weighting both ends lands exactly on the target when finished.
+        m_progress[i] = t;
+        m_current[i] = m_from[i] * (1.f - eased) + m_to[i] * eased;
+    }
+}
+
+#pragma endregion
\ No newline at end of file
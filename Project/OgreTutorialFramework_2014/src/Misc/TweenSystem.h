@@ -0,0 +1,165 @@
+#pragma once
+
+#ifndef _TWEEN_SYSTEM_
+#define _TWEEN_SYSTEM_
+
+
+// STL headers.
+#include <cstdint>
+#include <vector>
+
+
+/// <summary>
+/// Animates thousands of values between a minimum and maximum at once. Each tween moves from where it was when its target was last set to the
+/// target at a fixed speed, following an easing curve. The values are stored as arrays and every easing is a cubic polynomial, so a single
+/// branchless updateAll() advances every tween four at a time. Tweens are referred to by handles which become invalid once destroyed, every
+/// getter and setter checks the handle first so an invalid handle reads as zero and changes nothing.
+/// </summary>
+class TweenSystem final
+{
+    public:
+
+        /// <summary>
+        /// The shape of the curve between the start and target, ease in starts slowly and ease out finishes slowly.
+        /// </summary>
+        enum class Easing : unsigned char
+        {
+            Linear,
+            QuadraticIn,
+            QuadraticOut,
+            CubicIn,
+            CubicOut,
+            SmoothStep      //!< Eases in and out.
+        };
+
+        /// <summary>
+        /// Refers to a single tween. The generation stops a handle to a destroyed tween from affecting a new tween in the same slot.
+        /// </summary>
+        struct Handle final
+        {
+            std::uint32_t   index       { 0 };  //!< The slot of the tween in each array.
+            std::uint32_t   generation  { 0 };  //!< Zero is never used by a valid tween.
+        };
+
+        #pragma region Constructors and destructor
+
+        TweenSystem();
+
+        TweenSystem (TweenSystem&& move);
+        TweenSystem& operator= (TweenSystem&& move);
+
+        ~TweenSystem();
+
+        TweenSystem (const TweenSystem& copy)               = delete;
+        TweenSystem& operator= (const TweenSystem& copy)    = delete;
+
+        #pragma endregion
+
+        #pragma region Tween management
+
+        /// <summary> Gets the number of tweens which haven't been destroyed. </summary>
+        std::size_t getCount() const                        { return m_current.size() - m_free.size(); }
+
+        /// <summary> Creates a tween which starts and finishes at the given value. </summary>
+        /// <param name="min"> The lowest value, this is swapped with max if it's higher. </param>
+        /// <param name="max"> The highest value. </param>
+        /// <param name="current"> The starting value, this will be clamped between min and max. </param>
+        /// <param name="speed"> How far the value moves each second, 0 will jump straight to each target when it's set. </param>
+        Handle create (const float min, const float max, const float current, const float speed = 1.f, const Easing easing = Easing::Linear);
+
+        /// <summary> Destroys a tween, its slot will be reused by a future tween. Invalid handles are ignored. </summary>
+        void destroy (const Handle handle);
+
+        /// <summary> Checks whether a handle refers to a tween which hasn't been destroyed. </summary>
+        bool isValid (const Handle handle) const;
+
+        #pragma endregion
+
+        #pragma region Getters and setters
+
+        float getMin (const Handle handle) const            { return isValid (handle) ? m_min[handle.index] : 0.f; }
+        float getMax (const Handle handle) const            { return isValid (handle) ? m_max[handle.index] : 0.f; }
+        float getCurrent (const Handle handle) const        { return isValid (handle) ? m_current[handle.index] : 0.f; }
+        float getTarget (const Handle handle) const         { return isValid (handle) ? m_to[handle.index] : 0.f; }
+        float getSpeed (const Handle handle) const          { return isValid (handle) ? m_speed[handle.index] : 0.f; }
+        Easing getEasing (const Handle handle) const        { return isValid (handle) ? m_easing[handle.index] : Easing::Linear; }
+
+        /// <summary> Indicates whether the tween is increasing towards its target, invalid handles never are. </summary>
+        bool isAscending (const Handle handle) const        { return isValid (handle) && m_to[handle.index] > m_from[handle.index]; }
+
+        /// <summary> Indicates whether the tween has reached its target, invalid handles never do. </summary>
+        bool isFinished (const Handle handle) const         { return isValid (handle) && m_progress[handle.index] >= 1.f; }
+
+        /// <summary> Sets the minimum and maximum, clamping the current and target values into the new range. </summary>
+        void setRange (const Handle handle, const float min, const float max);
+
+        /// <summary> Moves the tween immediately, it will continue towards the same target from here. </summary>
+        void setCurrent (const Handle handle, const float current);
+
+        /// <summary> Sets the value to move towards, starting again from the current value. </summary>
+        void setTarget (const Handle handle, const float target);
+
+        /// <summary> Sets the target to a point between the minimum and maximum values. </summary>
+        /// <param name="target"> The point between minimum and maximum, 0.f to 1.f. </param>
+        void setNormalisedTarget (const Handle handle, const float target);
+
+        /// <summary> Sets how far the value moves each second, this takes effect from the current value. </summary>
+        void setSpeed (const Handle handle, const float speed);
+
+        void setEasing (const Handle handle, const Easing easing);
+
+        #pragma endregion
+
+        #pragma region Updating
+
+        /// <summary> Advances every tween in one pass, four at a time. Falls back to updateAllScalar() without SSE2. </summary>
+        /// <param name="deltaTime"> The number of seconds passed since the last update. </param>
+        void updateAll (const float deltaTime);
+
+        /// <summary> Gives the same results as updateAll() but advances one tween at a time. </summary>
+        /// <param name="deltaTime"> The number of seconds passed since the last update. </param>
+        void updateAllScalar (const float deltaTime);
+
+        /// <summary> Runs both updates over every easing, speed and direction and compares the results. </summary>
+        /// <returns> Whether every value matched within a small tolerance. </returns>
+        static bool verifyUpdate();
+
+        #pragma endregion
+
+    private:
+
+        #pragma region Helper functions
+
+        /// <summary> Starts the tween again from its current value, recalculating how quickly it progresses towards the target. </summary>
+        void restart (const std::uint32_t index);
+
+        /// <summary> Advances the tweens in [begin, end) one at a time. </summary>
+        void updateRange (const std::size_t begin, const std::size_t end, const float deltaTime);
+
+        #pragma endregion
+
+        #pragma region Implementation data
+
+        // Everything updateAll() touches.
+        std::vector<float>          m_from          {  };   //!< The value when the target was last set.
+        std::vector<float>          m_to            {  };   //!< The target value.
+        std::vector<float>          m_progress      {  };   //!< How far between the start and target the tween is, from 0.f to 1.f.
+        std::vector<float>          m_rate          {  };   //!< How much the progress increases each second.
+        std::vector<float>          m_cubic         {  };   //!< The t^3 coefficient of the easing.
+        std::vector<float>          m_quadratic     {  };   //!< The t^2 coefficient of the easing.
+        std::vector<float>          m_linear        {  };   //!< The t coefficient of the easing.
+        std::vector<float>          m_current       {  };   //!< The eased value.
+
+        // Only used when tweens are changed.
+        std::vector<float>          m_min           {  };   //!< The lowest value of each tween.
+        std::vector<float>          m_max           {  };   //!< The highest value of each tween.
+        std::vector<float>          m_speed         {  };   //!< How far each tween moves each second.
+        std::vector<Easing>         m_easing        {  };   //!< The curve of each tween.
+        std::vector<std::uint32_t>  m_generation    {  };   //!< Incremented whenever a slot is destroyed.
+        std::vector<std::uint32_t>  m_free          {  };   //!< Slots which can be reused.
+
+        #pragma endregion
+
+};
+
+#endif // _TWEEN_SYSTEM_
\ No newline at end of file
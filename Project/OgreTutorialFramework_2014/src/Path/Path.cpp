@@ -14,6 +14,7 @@
 
 
 // Engine headers.
+#include <Misc/Profiler.h>
 #include <Path/Segment.h>
 #include <Path/Waypoint.h>
 #include <Utility/Maths.h>
@@ -118,6 +119,7 @@ void Path::setWaypointScale (const Ogre::Vector3& scale, const bool updateCurren
             if (waypoint)
             {
                 waypoint->setScale (m_waypointScale);
+                waypoint->syncNode();
             }
         }
     }
@@ -130,16 +132,12 @@ void Path::setWaypointScale (const Ogre::Vector3& scale, const bool updateCurren
 
 bool Path::loadFromXML (const std::string& fileLocation, OgreApplication* const ogre, Ogre::SceneNode* const root)
 {
+    PROFILE_SCOPE ("Path::loadFromXML");
+
     // We'll use pugixml for loading via xml, the structure should be Path (Name, SamplersPerSegment) -> Segment -> Point (X, Y, Z). 
     // Segments are not limited but each segment must have four points.
     try
     {
-        // Pre-condition: We have valid pointers.
-        if (!ogre || !root)
-        {
-            throw std::invalid_argument ("Path::loadFromXML(), required parameter is a nullptr.");
-        }
-
         // Clear our current data.
         m_segments.clear();
         m_waypoints.clear();
@@ -200,8 +198,11 @@ bool Path::loadFromXML (const std::string& fileLocation, OgreApplication* const
         // Now we can calculate the length of the path!
         calculateLength (samplesPerSegment);
 
-        // Construct the way points.
-        constructWaypoints (ogre, root, pathName + "-Waypoint-");
+        // Construct the way points, headless paths don't need any visuals.
+        if (ogre && root)
+        {
+            constructWaypoints (ogre, root, pathName + "-Waypoint-");
+        }
 
         // And we're done with this lengthy process!
         return true;
@@ -233,6 +234,8 @@ bool Path::loadFromXML (const std::string& fileLocation, OgreApplication* const
 
 float Path::calculateLength (const unsigned int samplesPerSegment)
 {
+    PROFILE_SCOPE ("Path::calculateLength");
+
     // Pre-condition: Ensure we have a valid sample count.
     const auto samples  = samplesPerSegment == 0 ? 100 : samplesPerSegment;
 
@@ -343,6 +346,7 @@ Path::Waypoint* Path::createWaypoint (OgreApplication* const ogre, Ogre::SceneNo
     // Move the waypoint to the correct position.
     waypoint->setPosition (position);
     waypoint->setScale (m_waypointScale);
+    waypoint->syncNode();
 
     return waypoint;
 }
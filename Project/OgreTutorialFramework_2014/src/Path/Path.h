@@ -86,9 +86,10 @@ class Path final
 
         /// <summary> Loads the entire path from an XML file. Throws exceptions if an error occurs. </summary>
         /// <param name="fileLocation"> The location of the .xml file to load. </param>
-        /// <param name="ogre"> The application used
+        /// <param name="ogre"> The application used to create waypoints. A nullptr will load the path without any waypoints. </param>
+        /// <param name="root"> The node to attach the waypoints to. A nullptr will load the path without any waypoints. </param>
         /// <returns> Whether the loading was successful or not. </returns>
-        bool loadFromXML (const std::string& fileLocation, OgreApplication* const ogre, Ogre::SceneNode* const root);
+        bool loadFromXML (const std::string& fileLocation, OgreApplication* const ogre = nullptr, Ogre::SceneNode* const root = nullptr);
 
         #pragma endregion
 
@@ -0,0 +1,144 @@
+#include "PathSamples.h"
+
+
+
+// STL headers.
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+
+
+// Engine headers.
+#include <Path/Path.h>
+#include <Path/Segment.h>
+
+
+
+#pragma region Constructors and destructor
+
+PathSamples::PathSamples (const Path& path, const unsigned int samplesPerSegment)
+{
+    // Pre-condition: There is something to sample.
+    if (path.getSegmentCount() == 0)
+    {
+        throw std::invalid_argument ("PathSamples::PathSamples(), the path has no segments.");
+    }
+
+    const unsigned int  samples { samplesPerSegment == 0 ? 100 : samplesPerSegment };
+    const std::size_t   count   { path.getSegmentCount() * samples };
+
+    m_x.reserve (count);
+    m_z.reserve (count);
+    m_distance.reserve (count);
+
+    // The end of each segment is the start of the next so it isn't sampled twice.
+    for (unsigned int segment = 0; segment < path.getSegmentCount(); ++segment)
+    {
+        const auto curve = path.getSegment (segment);
+
+        for (unsigned int sample = 0; sample < samples; ++sample)
+        {
+            const auto point = curve->curvePoint (sample / static_cast<float> (samples));
+
+            m_distance.push_back (m_x.empty() ? 0.f : m_distance.back() + std::hypot (point.x - m_x.back(), point.z - m_z.back()));
+            m_x.push_back (point.x);
+            m_z.push_back (point.z);
+        }
+    }
+
+    m_length = m_distance.back() + std::hypot (m_x.front() - m_x.back(), m_z.front() - m_z.back());
+}
+
+
+PathSamples::PathSamples (PathSamples&& move)
+{
+    *this = std::move (move);
+}
+
+
+PathSamples& PathSamples::operator= (PathSamples&& move)
+{
+    if (this != &move)
+    {
+        m_x = std::move (move.m_x);
+        m_z = std::move (move.m_z);
+        m_distance = std::move (move.m_distance);
+        m_length = move.m_length;
+
+        move.m_length = 0.f;
+    }
+
+    return *this;
+}
+
+#pragma endregion
+
+
+#pragma region Queries
+
+std::size_t PathSamples::findClosest (const float x, const float z) const
+{
+    return findClosest (x, z, 0, getCount());
+}
+
+
+std::size_t PathSamples::findClosest (const float x, const float z, const std::size_t hint, const std::size_t window) const
+{
+    const std::size_t count { getCount() };
+    const std::size_t span  { std::min (window * 2 + 1, count) };
+
+    // Start behind the hint and walk forward, wrapping around the lap.
+    std::size_t closest     { hint % count };
+    float       best        { -1.f };
+
+    for (std::size_t i = 0, sample = (hint % count + count - std::min (window, count - 1)) % count; i < span; ++i, sample = (sample + 1) % count)
+    {
+        const float offsetX { m_x[sample] - x },
+                    offsetZ { m_z[sample] - z },
+                    squared { offsetX * offsetX + offsetZ * offsetZ };
+
+        if (best < 0.f || squared < best)
+        {
+            best = squared;
+            closest = sample;
+        }
+    }
+
+    return closest;
+}
+
+
+void PathSamples::pointAt (const float distance, float& x, float& z) const
+{
+    // Wrap the distance into the lap.
+    float lap { std::fmod (distance, m_length) };
+
+    if (lap < 0.f)
+    {
+        lap += m_length;
+    }
+
+    // Find the last sample before the distance, the sample after it may be the first one again.
+    const auto          after   = std::upper_bound (m_distance.begin(), m_distance.end(), lap);
+    const std::size_t   from    { static_cast<std::size_t> (after - m_distance.begin()) - 1 },
+                        to      { (from + 1) % getCount() };
+
+    const float start   { m_distance[from] },
+                end     { to == 0 ? m_length : m_distance[to] },
+                delta   { end > start ? (lap - start) / (end - start) : 0.f };
+
+    x = m_x[from] + (m_x[to] - m_x[from]) * delta;
+    z = m_z[from] + (m_z[to] - m_z[from]) * delta;
+}
+
+
+float PathSamples::headingAt (const std::size_t sample) const
+{
+    // A heading of zero faces along the z axis and increasing it turns towards the x axis.
+    const std::size_t next { (sample + 1) % getCount() };
+
+    return std::atan2 (m_x[next] - m_x[sample], m_z[next] - m_z[sample]);
+}
+
+#pragma endregion
\ No newline at end of file
@@ -0,0 +1,88 @@
+#pragma once
+
+#ifndef _PATH_SAMPLES_
+#define _PATH_SAMPLES_
+
+
+// STL headers.
+#include <vector>
+
+
+// Forward declarations.
+class Path;
+
+
+/// <summary>
+/// A closed polyline sampled from a Path with the arc length at each sample. Evaluating bezier curves is too slow for thousands of queries
+/// per step, so drivers share a single read-only table instead. The last sample joins back up to the first, as a Path is driven in laps.
+/// </summary>
+class PathSamples final
+{
+    public:
+
+        #pragma region Constructors and destructor
+
+        /// <summary> Samples every segment of a path. Throws if the path has no segments. </summary>
+        /// <param name="path"> The loaded path to sample. </param>
+        /// <param name="samplesPerSegment"> How many samples to take from each segment, 0 will default to 100. </param>
+        PathSamples (const Path& path, const unsigned int samplesPerSegment = 100);
+
+        PathSamples (PathSamples&& move);
+        PathSamples& operator= (PathSamples&& move);
+
+        ~PathSamples()                                  = default;
+
+        PathSamples (const PathSamples& copy)           = delete;
+        PathSamples& operator= (const PathSamples& copy) = delete;
+
+        #pragma endregion
+
+        #pragma region Getters
+
+        /// <summary> Gets the number of samples taken. </summary>
+        std::size_t getCount() const                    { return m_x.size(); }
+
+        /// <summary> Gets the length of a full lap, including the join from the last sample to the first. </summary>
+        float getLength() const                         { return m_length; }
+
+        float getX (const std::size_t sample) const     { return m_x[sample]; }
+        float getZ (const std::size_t sample) const     { return m_z[sample]; }
+
+        /// <summary> Gets how far along the lap a sample is. </summary>
+        float getDistance (const std::size_t sample) const  { return m_distance[sample]; }
+
+        #pragma endregion
+
+        #pragma region Queries
+
+        /// <summary> Finds the sample closest to a position by checking every sample. </summary>
+        std::size_t findClosest (const float x, const float z) const;
+
+        /// <summary> Finds the sample closest to a position near a previous result, this is cheap when called every step. </summary>
+        /// <param name="hint"> The previous closest sample. </param>
+        /// <param name="window"> How many samples either side of the hint to check. </param>
+        std::size_t findClosest (const float x, const float z, const std::size_t hint, const std::size_t window) const;
+
+        /// <summary> Finds the point at a distance along the lap, interpolating between samples. </summary>
+        /// <param name="distance"> Distances outside of the lap wrap around. </param>
+        void pointAt (const float distance, float& x, float& z) const;
+
+        /// <summary> Gets the heading of the lap at a sample, in the same convention as a VehicleState. </summary>
+        float headingAt (const std::size_t sample) const;
+
+        #pragma endregion
+
+    private:
+
+        #pragma region Implementation data
+
+        std::vector<float>  m_x         {  };       //!< The position of each sample on the x axis.
+        std::vector<float>  m_z         {  };       //!< The position of each sample on the z axis.
+        std::vector<float>  m_distance  {  };       //!< How far along the lap each sample is, the first sample is at zero.
+        float               m_length    { 0.f };    //!< The length of a full lap.
+
+        #pragma endregion
+
+};
+
+#endif // _PATH_SAMPLES_
\ No newline at end of file
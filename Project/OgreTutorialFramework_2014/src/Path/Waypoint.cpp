@@ -21,6 +21,11 @@ Path::Waypoint& Path::Waypoint::operator= (Waypoint&& move)
     {
         // IActor.
         m_node = std::move (move.m_node);
+        m_position = std::move (move.m_position);
+        m_orientation = std::move (move.m_orientation);
+        m_scale = std::move (move.m_scale);
+        m_previousPosition = std::move (move.m_previousPosition);
+        m_previousOrientation = std::move (move.m_previousOrientation);
     }
 
     return *this;
@@ -0,0 +1,181 @@
+#include "NullRenderer.h"
+
+
+
+// STL headers.
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+#include <unordered_set>
+
+
+
+// Globals.
+const Ogre::String movableType { "NullDrawable" };  //!< The type name reported by every NullDrawable.
+
+
+
+#pragma region DrawStatistics
+
+DrawStatistics& DrawStatistics::operator+= (const DrawStatistics& other)
+{
+    submissions += other.submissions;
+    triangles += other.triangles;
+    visibleObjects += other.visibleObjects;
+    culledObjects += other.culledObjects;
+
+    return *this;
+}
+
+#pragma endregion
+
+
+#pragma region NullDrawable
+
+NullDrawable::NullDrawable (const Ogre::String& name, NullRenderer& renderer, const Ogre::String& mesh, const Ogre::String& material)
+    : Ogre::MovableObject (name), m_renderer (renderer), m_material (material)
+{
+    // Without a render system the buffers live in system memory, which is all we need for the bounds and batch sizes.
+    m_mesh = Ogre::MeshManager::getSingleton().load (mesh, Ogre::ResourceGroupManager::AUTODETECT_RESOURCE_GROUP_NAME);
+
+    // Each sub-mesh is a separate batch.
+    const auto subMeshes = m_mesh->getNumSubMeshes();
+    m_submissions = subMeshes;
+
+    for (unsigned short i = 0; i < subMeshes; ++i)
+    {
+        const auto subMesh = m_mesh->getSubMesh (i);
+
+        // Non-indexed meshes draw their vertices directly.
+        if (subMesh->indexData && subMesh->indexData->indexCount > 0)
+        {
+            m_triangles += static_cast<unsigned long> (subMesh->indexData->indexCount / 3);
+        }
+
+        else
+        {
+            const auto vertexData = subMesh->useSharedVertices ? m_mesh->sharedVertexData : subMesh->vertexData;
+            m_triangles += vertexData ? static_cast<unsigned long> (vertexData->vertexCount / 3) : 0;
+        }
+    }
+}
+
+
+const Ogre::String& NullDrawable::getMovableType() const
+{
+    return movableType;
+}
+
+
+const Ogre::AxisAlignedBox& NullDrawable::getBoundingBox() const
+{
+    return m_mesh->getBounds();
+}
+
+
+Ogre::Real NullDrawable::getBoundingRadius() const
+{
+    return m_mesh->getBoundingSphereRadius();
+}
+
+
+void NullDrawable::_updateRenderQueue (Ogre::RenderQueue* queue)
+{
+    m_renderer.recordSubmission (*this);
+}
+
+
+void NullDrawable::visitRenderables (Ogre::Renderable::Visitor* visitor, bool debugRenderables)
+{
+}
+
+#pragma endregion
+
+
+#pragma region NullRenderer
+
+NullRenderer::NullRenderer (Ogre::SceneManager* const sceneManager)
+    : m_sceneManager (sceneManager)
+{
+    // Pre-condition: We have a scene to render.
+    if (!sceneManager)
+    {
+        throw std::invalid_argument ("NullRenderer::NullRenderer(), required parameter is a nullptr.");
+    }
+}
+
+
+NullRenderer::~NullRenderer()
+{
+    destroyAllDrawables();
+}
+
+
+NullDrawable* NullRenderer::createDrawable (const Ogre::String& mesh, const Ogre::String& material)
+{
+    const auto name = movableType + std::to_string (m_nextID++);
+
+    m_drawables.push_back (std::unique_ptr<NullDrawable> (new NullDrawable (name, *this, mesh, material)));
+
+    return m_drawables.back().get();
+}
+
+
+void NullRenderer::destroyDrawables (const std::vector<Ogre::MovableObject*>& drawables)
+{
+    const std::unordered_set<const Ogre::MovableObject*> doomed { drawables.begin(), drawables.end() };
+
+    m_drawables.erase (std::remove_if (m_drawables.begin(), m_drawables.end(), [&] (const std::unique_ptr<NullDrawable>& drawable)
+    {
+        return doomed.count (drawable.get()) != 0;
+    }), m_drawables.end());
+}
+
+
+void NullRenderer::destroyAllDrawables()
+{
+    // Each drawable detaches itself from its SceneNode when destroyed.
+    m_drawables.clear();
+}
+
+
+void NullRenderer::renderOneFrame()
+{
+    m_current = DrawStatistics();
+
+    if (m_camera)
+    {
+        // Perform the same scene work as a real frame, only the render queue is left empty.
+        Ogre::SceneManager::VisibleObjectsBoundsInfo visibleBounds {  };
+
+        m_sceneManager->_updateSceneGraph (m_camera);
+        m_sceneManager->_findVisibleObjects (m_camera, &visibleBounds, false);
+    }
+
+    // Anything attached but not submitted was culled.
+    unsigned long attached { 0 };
+
+    for (const auto& drawable : m_drawables)
+    {
+        if (drawable->isAttached())
+        {
+            ++attached;
+        }
+    }
+
+    m_current.culledObjects = attached - m_current.visibleObjects;
+
+    m_lastFrame = m_current;
+    m_total += m_current;
+    ++m_frameCount;
+}
+
+
+void NullRenderer::recordSubmission (const NullDrawable& drawable)
+{
+    m_current.submissions += drawable.getSubmissionCount();
+    m_current.triangles += drawable.getTriangleCount();
+    ++m_current.visibleObjects;
+}
+
+#pragma endregion
\ No newline at end of file
@@ -0,0 +1,179 @@
+#pragma once
+
+#ifndef _NULL_RENDERER_
+#define _NULL_RENDERER_
+
+
+// STL headers.
+#include <memory>
+#include <vector>
+
+
+// Forward declarations.
+class NullRenderer;
+
+
+/// <summary>
+/// The draw submissions recorded by the NullRenderer, either for a single frame or accumulated over many frames.
+/// </summary>
+struct DrawStatistics final
+{
+    unsigned long   submissions     { 0 };  //!< The number of batches which would be sent to the GPU, one per sub-mesh of each visible object.
+    unsigned long   triangles       { 0 };  //!< The number of triangles those batches contain.
+    unsigned long   visibleObjects  { 0 };  //!< The number of objects which passed frustum culling.
+    unsigned long   culledObjects   { 0 };  //!< The number of registered objects which were attached to the scene but not submitted.
+
+    /// <summary> Adds the statistics of another frame to our own. </summary>
+    DrawStatistics& operator+= (const DrawStatistics& other);
+};
+
+
+/// <summary>
+/// Stands in for an Ogre::Entity when there is no render system. The mesh is loaded into system memory purely to provide bounds and the
+/// size of each batch, materials are remembered by name but never loaded because compiling them requires a render system.
+/// </summary>
+class NullDrawable final : public Ogre::MovableObject
+{
+    public:
+
+        #pragma region Constructors and destructor
+
+        /// <summary> Creates a drawable for the given mesh, the mesh is loaded if necessary. </summary>
+        /// <param name="name"> A unique name for the MovableObject. </param>
+        /// <param name="renderer"> The renderer to report submissions to. </param>
+        /// <param name="mesh"> The name of the mesh resource to draw. </param>
+        /// <param name="material"> The material the object would be drawn with. </param>
+        NullDrawable (const Ogre::String& name, NullRenderer& renderer, const Ogre::String& mesh, const Ogre::String& material);
+
+        ~NullDrawable() override                            = default;
+
+        NullDrawable (NullDrawable&& move)                  = delete;
+        NullDrawable& operator= (NullDrawable&& move)       = delete;
+        NullDrawable (const NullDrawable& copy)             = delete;
+        NullDrawable& operator= (const NullDrawable& copy)  = delete;
+
+        #pragma endregion
+
+        #pragma region Getters and setters
+
+        /// <summary> Gets the name of the material the object would be drawn with. </summary>
+        const Ogre::String& getMaterialName() const         { return m_material; }
+
+        /// <summary> Gets how many batches drawing the object would take. </summary>
+        unsigned long getSubmissionCount() const            { return m_submissions; }
+
+        /// <summary> Gets how many triangles drawing the object would submit. </summary>
+        unsigned long getTriangleCount() const              { return m_triangles; }
+
+        #pragma endregion
+
+        #pragma region Ogre::MovableObject
+
+        const Ogre::String& getMovableType() const override;
+        const Ogre::AxisAlignedBox& getBoundingBox() const override;
+        Ogre::Real getBoundingRadius() const override;
+
+        /// <summary> Called by the SceneManager for each visible object, we record the submission instead of queueing renderables. </summary>
+        void _updateRenderQueue (Ogre::RenderQueue* queue) override;
+
+        /// <summary> There are no renderables to visit. </summary>
+        void visitRenderables (Ogre::Renderable::Visitor* visitor, bool debugRenderables = false) override;
+
+        #pragma endregion
+
+    private:
+
+        #pragma region Implementation data
+
+        NullRenderer&   m_renderer;                 //!< Receives each draw submission.
+        Ogre::MeshPtr   m_mesh          {  };       //!< The system memory copy of the mesh, used for its bounds.
+        Ogre::String    m_material      {  };       //!< The material which would be used.
+        unsigned long   m_submissions   { 0 };      //!< The number of sub-meshes in the mesh.
+        unsigned long   m_triangles     { 0 };      //!< The number of triangles in the mesh.
+
+        #pragma endregion
+
+};
+
+
+/// <summary>
+/// A render backend which performs no GPU work. Each frame the scene graph is updated and culled against the camera exactly as Ogre would,
+/// then the draw submissions of every visible NullDrawable are counted. This allows the full application to run headless, e.g. on CI.
+/// </summary>
+class NullRenderer final
+{
+    public:
+
+        #pragma region Constructors and destructor
+
+        /// <summary> Creates a renderer for the given scene. </summary>
+        /// <param name="sceneManager"> The scene to render, must be valid. </param>
+        NullRenderer (Ogre::SceneManager* const sceneManager);
+
+        ~NullRenderer();
+
+        NullRenderer (NullRenderer&& move)                  = delete;
+        NullRenderer& operator= (NullRenderer&& move)       = delete;
+        NullRenderer (const NullRenderer& copy)             = delete;
+        NullRenderer& operator= (const NullRenderer& copy)  = delete;
+
+        #pragma endregion
+
+        #pragma region Getters and setters
+
+        /// <summary> Gets the submissions recorded during the most recent frame. </summary>
+        const DrawStatistics& getLastFrame() const          { return m_lastFrame; }
+
+        /// <summary> Gets the submissions recorded since the renderer was created. </summary>
+        const DrawStatistics& getTotal() const              { return m_total; }
+
+        /// <summary> Gets how many frames have been rendered. </summary>
+        unsigned long getFrameCount() const                 { return m_frameCount; }
+
+        /// <summary> Sets the camera used for culling, without one nothing is rendered. </summary>
+        void setCamera (Ogre::Camera* const camera)         { m_camera = camera; }
+
+        #pragma endregion
+
+        #pragma region Public interface
+
+        /// <summary> Creates a drawable which the renderer owns, it must be attached to a SceneNode to be rendered. </summary>
+        /// <param name="mesh"> The name of the mesh resource to draw. </param>
+        /// <param name="material"> The material the object would be drawn with. </param>
+        NullDrawable* createDrawable (const Ogre::String& mesh, const Ogre::String& material);
+
+        /// <summary> Destroys the given drawables, detaching them from the scene. Objects the renderer didn't create are ignored. </summary>
+        /// <param name="drawables"> Every drawable to destroy, they are destroyed together so this is linear however many there are. </param>
+        void destroyDrawables (const std::vector<Ogre::MovableObject*>& drawables);
+
+        /// <summary> Destroys every drawable, detaching them from the scene. </summary>
+        void destroyAllDrawables();
+
+        /// <summary> Updates the scene graph, culls it and records the draw submissions of the frame. </summary>
+        void renderOneFrame();
+
+        /// <summary> Records the submission of a visible drawable, called by the drawable whilst the scene is culled. </summary>
+        void recordSubmission (const NullDrawable& drawable);
+
+        #pragma endregion
+
+    private:
+
+        #pragma region Implementation data
+
+        Ogre::SceneManager*                         m_sceneManager  { nullptr };    //!< The scene to render.
+        Ogre::Camera*                               m_camera        { nullptr };    //!< The camera to cull against.
+
+        std::vector<std::unique_ptr<NullDrawable>>  m_drawables     {  };           //!< Every drawable which has been created.
+        unsigned long                               m_nextID        { 0 };          //!< Used to give each drawable a unique name.
+
+        DrawStatistics                              m_current       {  };           //!< The submissions of the frame being rendered.
+        DrawStatistics                              m_lastFrame     {  };           //!< The submissions of the previous frame.
+        DrawStatistics                              m_total         {  };           //!< The submissions of every frame.
+        unsigned long                               m_frameCount    { 0 };          //!< The number of frames rendered.
+
+        #pragma endregion
+
+};
+
+#endif // _NULL_RENDERER_
\ No newline at end of file
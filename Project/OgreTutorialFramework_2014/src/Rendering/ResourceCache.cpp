@@ -0,0 +1,68 @@
+#include "ResourceCache.h"
+
+
+
+#pragma region Constructors and destructor
+
+ResourceCache::ResourceCache (ResourceCache&& move)
+{
+    *this = std::move (move);
+}
+
+
+ResourceCache& ResourceCache::operator= (ResourceCache&& move)
+{
+    if (this != &move)
+    {
+        m_meshes = std::move (move.m_meshes);
+        m_materials = std::move (move.m_materials);
+    }
+
+    return *this;
+}
+
+#pragma endregion
+
+
+#pragma region Cache functionality
+
+const Ogre::MeshPtr& ResourceCache::getMesh (const Ogre::String& name)
+{
+    auto& mesh = m_meshes[name];
+
+    if (mesh.isNull())
+    {
+        mesh = Ogre::MeshManager::getSingleton().load (name, Ogre::ResourceGroupManager::AUTODETECT_RESOURCE_GROUP_NAME);
+    }
+
+    return mesh;
+}
+
+
+Ogre::MaterialPtr ResourceCache::getMaterial (const Ogre::String& name)
+{
+    const auto cached = m_materials.find (name);
+
+    if (cached != m_materials.end())
+    {
+        return cached->second;
+    }
+
+    const auto material = Ogre::MaterialManager::getSingleton().getByName (name);
+
+    if (!material.isNull())
+    {
+        m_materials.emplace (name, material);
+    }
+
+    return material;
+}
+
+
+void ResourceCache::clear()
+{
+    m_meshes.clear();
+    m_materials.clear();
+}
+
+#pragma endregion
\ No newline at end of file
@@ -0,0 +1,60 @@
+#pragma once
+
+#ifndef _RESOURCE_CACHE_
+#define _RESOURCE_CACHE_
+
+
+// STL headers.
+#include <unordered_map>
+
+
+/// <summary>
+/// Remembers every mesh and material handed to util::createEntity(). Creating an entity by name asks the MeshManager to find and load the
+/// mesh and the MaterialManager to find the material every time, with a fleet of badgers that is thousands of identical lookups. The cache
+/// holds a reference to each resource so they stay loaded until the cache is cleared, which must happen before Ogre shuts down.
+/// </summary>
+class ResourceCache final
+{
+    public:
+
+        #pragma region Constructors and destructor
+
+        ResourceCache()                                     = default;
+        ~ResourceCache()                                    = default;
+
+        ResourceCache (ResourceCache&& move);
+        ResourceCache& operator= (ResourceCache&& move);
+
+        ResourceCache (const ResourceCache& copy)           = delete;
+        ResourceCache& operator= (const ResourceCache& copy) = delete;
+
+        #pragma endregion
+
+        #pragma region Cache functionality
+
+        /// <summary> Gets a loaded mesh, it is loaded the first time it's requested. </summary>
+        /// <param name="name"> The filename of the mesh. </param>
+        const Ogre::MeshPtr& getMesh (const Ogre::String& name);
+
+        /// <summary> Gets a material, only materials which exist are cached so one created later will still be found. </summary>
+        /// <param name="name"> The name of the material. </param>
+        /// <returns> The material, this is null if it doesn't exist yet. </returns>
+        Ogre::MaterialPtr getMaterial (const Ogre::String& name);
+
+        /// <summary> Releases every cached resource. </summary>
+        void clear();
+
+        #pragma endregion
+
+    private:
+
+        #pragma region Implementation data
+
+        std::unordered_map<Ogre::String, Ogre::MeshPtr>     m_meshes    {  };   //!< Every mesh requested so far, by filename.
+        std::unordered_map<Ogre::String, Ogre::MaterialPtr> m_materials {  };   //!< Every material found so far, by name.
+
+        #pragma endregion
+
+};
+
+#endif // _RESOURCE_CACHE_
\ No newline at end of file
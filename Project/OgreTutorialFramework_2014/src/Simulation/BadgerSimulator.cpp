@@ -4,17 +4,45 @@
 
 // STL headers.
 #include <exception>
+#include <iostream>
 
 
 
 // Engine headers.
 #include <Badger/Badger.h>
 #include <Framework/OgreApplication.h>
+#include <Misc/Profiler.h>
+#include <Misc/StateBuffer.h>
 #include <Utility/Maths.h>
 #include <Utility/Ogre.h>
 
 
 
+// Globals.
+const unsigned int keyUp    { 1 << 0 };     //!< Set in the captured keys when the up arrow is held.
+const unsigned int keyDown  { 1 << 1 };     //!< Set in the captured keys when the down arrow is held.
+const unsigned int keyLeft  { 1 << 2 };     //!< Set in the captured keys when the left arrow is held.
+const unsigned int keyRight { 1 << 3 };     //!< Set in the captured keys when the right arrow is held.
+
+
+
+// Helper functions.
+
+/// <summary> Converts a key code into its bit in the captured keys, keys which don't control the badger have no bit. </summary>
+static unsigned int keyBit (const OIS::KeyCode key)
+{
+    switch (key)
+    {
+        case OIS::KC_UP:    return keyUp;
+        case OIS::KC_DOWN:  return keyDown;
+        case OIS::KC_LEFT:  return keyLeft;
+        case OIS::KC_RIGHT: return keyRight;
+        default:            return 0;
+    }
+}
+
+
+
 #pragma region Constructors and destructor
 
 BadgerSimulator::BadgerSimulator() 
@@ -32,9 +60,11 @@ BadgerSimulator& BadgerSimulator::operator= (BadgerSimulator&& move)
 {
     if (this != &move)
     {
-        m_keyboard = std::move (move.m_keyboard);
+        m_input = std::move (move.m_input);
         m_badger = std::move (move.m_badger);
 
+        m_keys = std::move (move.m_keys);
+
         m_speedRate = std::move (move.m_speedRate);
         m_turnRate = std::move (move.m_turnRate);
     }
@@ -67,8 +97,11 @@ bool BadgerSimulator::initialise (OgreApplication* const ogre)
     util::createMaterial ("blue", "blue.png");
     util::createMaterial ("green", "green.png");
 
-    // Initialise the input.
-    m_keyboard = ogre->GetKeyboard();
+    // Initialise the input, there is none when headless.
+    if (ogre->GetInput())
+    {
+        m_input = ogre->GetInput()->subscribe();
+    }
 
     // Set up the badgers.
     m_badger = std::make_unique<Badger>();
@@ -78,6 +111,36 @@ bool BadgerSimulator::initialise (OgreApplication* const ogre)
 }
 
 
+bool BadgerSimulator::initialise (Ogre::SceneNode* const root, const Ogre::String& name)
+{
+    try
+    {
+        // Pre-condition: We have a valid root node.
+        if (!root)
+        {
+            throw std::invalid_argument ("BadgerSimulator::initialise(), required parameter 'root' is a nullptr.");
+        }
+
+        // Without an OgreApplication the badger won't create any entities.
+        m_badger = std::make_unique<Badger>();
+    
+        return m_badger->initialise (nullptr, root, name);
+    }
+
+    catch (const std::exception& error)
+    {
+        std::cerr << "Exception caught in BadgerSimulator::initialise(): " << error.what() << std::endl;
+    }
+
+    catch (...)
+    {
+        std::cerr << "An unknown error was caught in BadgerSimulator::initialise()." << std::endl;
+    }
+
+    return false;
+}
+
+
 void BadgerSimulator::reset()
 {
     if (m_badger)
@@ -91,52 +154,127 @@ void BadgerSimulator::reset()
 
 void BadgerSimulator::update (const float deltaTime)
 {
+    PROFILE_SCOPE ("BadgerSimulator::update");
+
     // We need to update the input and have the badger reflect the change of input.
     updateInput();
+    m_badger->beginStep();
     m_badger->updateSimulation (deltaTime);
 }
 
+
+void BadgerSimulator::declareDependencies (SimulatorDependencies& dependencies) const
+{
+    // The keyboard is only read through the events queued by the main thread.
+    dependencies.reads.push_back ("Input");
+}
+
+
+void BadgerSimulator::interpolate (const float alpha)
+{
+    m_badger->interpolate (alpha);
+}
+
+
+void BadgerSimulator::publish (TransformSnapshot& snapshot) const
+{
+    m_badger->publish (snapshot);
+}
+
+
+void BadgerSimulator::saveState (StateBuffer& buffer) const
+{
+    buffer.write (m_speedRate);
+    buffer.write (m_turnRate);
+
+    m_badger->saveState (buffer);
+}
+
+
+void BadgerSimulator::restoreState (StateBuffer& buffer)
+{
+    buffer.read (m_speedRate);
+    buffer.read (m_turnRate);
+
+    m_badger->restoreState (buffer);
+}
+
 #pragma endregion
 
 
 #pragma region Simulation management
 
+void BadgerSimulator::setControls (const float speedRate, const float turnRate)
+{
+    setSpeedRate (speedRate);
+    setTurnRate (turnRate);
+}
+
+
+void BadgerSimulator::setIntegrator (const VehicleModel::Integrator integrator)
+{
+    m_badger->setIntegrator (integrator);
+}
+
+
 void BadgerSimulator::updateInput()
 {
-    // Initialise default speed and turn rate values.
-    float   speedRate   { 0.f },
-            turnRate    { 0.f };
-    
-    // Lock the weak pointer.
-    auto keyboard = m_keyboard.lock();
-    
-    if (keyboard)
+    // Without input we keep whatever controls have been given to us.
+    if (!m_input)
     {
-        // Add to the speed rate if up is pressed.
-        if (keyboard->isKeyDown (OIS::KC_UP))
-        {
-            speedRate += 1.f;
-        }
+        return;
+    }
 
-        // Subtract from the speed rate if down is pressed.
-        if (keyboard->isKeyDown (OIS::KC_DOWN))
-        {
-            speedRate -= 1.f;
-        }
+    // Keys pressed since the last update count as held for this update, even if they've already been released, so taps aren't missed.
+    unsigned int    pressed { 0 };
+    InputEvent      event   {  };
+
+    while (m_input->pop (event))
+    {
+        const unsigned int key { keyBit (event.key) };
 
-        // Subtract from the turn rate if left is pressed.
-        if (keyboard->isKeyDown (OIS::KC_LEFT))
+        if (event.type == InputEvent::Type::KeyPressed)
         {
-            turnRate -= 1.f;
+            m_keys |= key;
+            pressed |= key;
         }
 
-        // Add to the turn rate if right is pressed.
-        if (keyboard->isKeyDown (OIS::KC_RIGHT))
+        else if (event.type == InputEvent::Type::KeyReleased)
         {
-            turnRate += 1.f;
+            m_keys &= ~key;
         }
     }
 
+    const unsigned int keys { m_keys | pressed };
+
+    // Initialise default speed and turn rate values.
+    float   speedRate   { 0.f },
+            turnRate    { 0.f };
+
+    // Add to the speed rate if up is pressed.
+    if (keys & keyUp)
+    {
+        speedRate += 1.f;
+    }
+
+    // Subtract from the speed rate if down is pressed.
+    if (keys & keyDown)
+    {
+        speedRate -= 1.f;
+    }
+
+    // Subtract from the turn rate if left is pressed.
+    if (keys & keyLeft)
+    {
+        turnRate -= 1.f;
+    }
+
+    // Add to the turn rate if right is pressed.
+    if (keys & keyRight)
+    {
+        turnRate += 1.f;
+    }
+
     // Update the badgers values.
     setSpeedRate (speedRate);
     setTurnRate (turnRate);
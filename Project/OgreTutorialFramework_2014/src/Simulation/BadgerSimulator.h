@@ -9,6 +9,8 @@
 
 
 // Engine headers.
+#include <Badger/VehicleModel.h>
+#include <Input/BufferedInput.h>
 #include <Simulation/ISimulator.h>
 
 
@@ -43,6 +45,11 @@ class BadgerSimulator final : public ISimulator
         /// <param name="ogre"> The OgreApplication which contains the SceneManager and Keyboard required to function. </param>
         bool initialise (OgreApplication* const ogre) override final;
 
+        /// <summary> Initialises a headless badger with no entities or input, it must be driven using setControls(). </summary>
+        /// <param name="root"> The SceneNode to attach the badger to. </param>
+        /// <param name="name"> The unique name to give the badger. </param>
+        bool initialise (Ogre::SceneNode* const root, const Ogre::String& name);
+
         /// <summary> Resets the BadgerSimulator to initial values, completely restarting the BadgerSimulator. </summary>
         void reset() override final;
 
@@ -50,13 +57,44 @@ class BadgerSimulator final : public ISimulator
         /// <param name="deltaTime"> The value in seconds to update the BadgerSimulator with. </param>
         void update (const float deltaTime) override final;
 
+        /// <summary> Declares the resources shared with other simulators. </summary>
+        void declareDependencies (SimulatorDependencies& dependencies) const override final;
+
+        /// <summary> Blends the badger between the previous and current update. </summary>
+        /// <param name="alpha"> How far between the previous (0.f) and current (1.f) update to render the badger. </param>
+        void interpolate (const float alpha) override final;
+
+        /// <summary> Publishes the transform of the badger. </summary>
+        /// <param name="snapshot"> The snapshot being written by the simulation. </param>
+        void publish (TransformSnapshot& snapshot) const override final;
+
+        /// <summary> Appends the state of the BadgerSimulator and its badger. </summary>
+        /// <param name="buffer"> The buffer to append to. </param>
+        void saveState (StateBuffer& buffer) const override final;
+
+        /// <summary> Restores the state of the BadgerSimulator and its badger. </summary>
+        /// <param name="buffer"> The buffer to read from. </param>
+        void restoreState (StateBuffer& buffer) override final;
+
+        #pragma endregion
+
+        #pragma region Simulation management
+
+        /// <summary> Drives the badger without input. Any keyboard input will override these values. </summary>
+        /// <param name="speedRate"> The value for the forward speed, this should be clamped between -1.f and 1.f. </param>
+        /// <param name="turnRate"> The value for the turn rate, this should be clamped between -1.f and 1.f. </param>
+        void setControls (const float speedRate, const float turnRate);
+
+        /// <summary> Sets how the badger is stepped, this must be called after initialisation. </summary>
+        void setIntegrator (const VehicleModel::Integrator integrator);
+
         #pragma endregion
 
     private:
 
         #pragma region Simulation management
 
-        /// <summary> Updates the input to ensure the correct input is being used. </summary>
+        /// <summary> Consumes every queued key event and applies the arrow keys to the badger. </summary>
         void updateInput();
         
         /// <summary> Sets the desired forward speed of the wheels. </summary>
@@ -71,9 +109,11 @@ class BadgerSimulator final : public ISimulator
 
         #pragma region Implmentation data
         
-        std::weak_ptr<OIS::Keyboard>    m_keyboard  {  };           //!< A weak reference to the keyboard when input is required.
+        std::shared_ptr<InputQueue>     m_input     { nullptr };    //!< The key events captured since the last update, only when input is required.
         std::unique_ptr<Badger>         m_badger    { nullptr };    //!< The badger vehicle used to demonstrate the use of keyboard input.
 
+        unsigned int                    m_keys      { 0 };          //!< The arrow keys held down according to the events consumed so far, one bit per key.
+
         float                           m_speedRate { 0.f };        //!< A normalised wheel speed for the Badger, from -1.f to 1.f.
         float                           m_turnRate  { 0.f };        //!< A normalised turn rate for the Badger, from -1.f to 1.f.
 
@@ -0,0 +1,144 @@
+#include "FleetSimulator.h"
+
+
+
+// STL headers.
+#include <exception>
+#include <iostream>
+
+
+
+// Engine headers.
+#include <Framework/OgreApplication.h>
+#include <Misc/Profiler.h>
+#include <Utility/Ogre.h>
+
+
+
+// Globals.
+const float avoidanceRadius { 40.f };   //!< Close enough that badgers sharing a circle still steer around each other.
+
+
+
+#pragma region Constructors and destructor
+
+FleetSimulator::FleetSimulator()
+{
+}
+
+
+FleetSimulator::FleetSimulator (FleetSimulator&& move)
+{
+    *this = std::move (move);
+}
+
+
+FleetSimulator& FleetSimulator::operator= (FleetSimulator&& move)
+{
+    if (this != &move)
+    {
+        m_fleet = std::move (move.m_fleet);
+    }
+
+    return *this;
+}
+
+
+FleetSimulator::~FleetSimulator()
+{
+}
+
+#pragma endregion
+
+
+#pragma region ISimulator functionality
+
+bool FleetSimulator::initialise (OgreApplication* const ogre)
+{
+    // Pre-condition: We have a valid OgreApplication
+    if (!ogre)
+    {
+        throw std::invalid_argument ("FleetSimulator::initialise(), required parameter 'ogre' is a nullptr.");
+    }
+
+    // Ensure the scene and the materials used by non-instanced badgers exist.
+    ogre->CreateScene();
+
+    util::createMaterial ("blue", "blue.png");
+    util::createMaterial ("green", "green.png");
+
+    // Flattening means Ogre never has to propagate a chassis to its parts, which matters once there are thousands of them.
+    const bool initialised { ogre->IsFleetInstanced() ?
+        m_fleet.initialiseInstanced (ogre->GetFleetSize(), ogre, "FleetSimulator") :
+        m_fleet.initialise (ogre->GetFleetSize(), ogre, ogre->GetSceneManager()->getRootSceneNode(), "FleetSimulator", true) };
+
+    if (!initialised)
+    {
+        return false;
+    }
+
+    m_fleet.setAvoidanceRadius (avoidanceRadius);
+    setControls();
+
+    std::cout << "FleetSimulator: " << m_fleet.getCount() << " badgers, " << (m_fleet.isInstanced() ? "instanced" : "one entity per part") << std::endl;
+
+    return true;
+}
+
+
+void FleetSimulator::reset()
+{
+    m_fleet.reset();
+    setControls();
+}
+
+
+void FleetSimulator::update (const float deltaTime)
+{
+    PROFILE_SCOPE ("FleetSimulator::update");
+
+    m_fleet.beginStep();
+    m_fleet.updateSimulation (deltaTime);
+}
+
+
+void FleetSimulator::interpolate (const float alpha)
+{
+    m_fleet.interpolate (alpha);
+}
+
+
+void FleetSimulator::publish (TransformSnapshot& snapshot) const
+{
+    m_fleet.publish (snapshot);
+}
+
+
+void FleetSimulator::saveState (StateBuffer& buffer) const
+{
+    m_fleet.saveState (buffer);
+}
+
+
+void FleetSimulator::restoreState (StateBuffer& buffer)
+{
+    m_fleet.restoreState (buffer);
+}
+
+#pragma endregion
+
+
+#pragma region Simulation management
+
+void FleetSimulator::setControls()
+{
+    const std::size_t count { m_fleet.getCount() };
+
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        m_fleet.setSpeedRate (i, 1.f);
+        m_fleet.setTurnRate (i, static_cast<float> (i % 5) * 0.2f - 0.4f);
+    }
+}
+
+#pragma endregion
\ No newline at end of file
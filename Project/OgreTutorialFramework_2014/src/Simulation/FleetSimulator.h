@@ -0,0 +1,82 @@
+#pragma once
+
+#ifndef _FLEET_SIMULATOR_
+#define _FLEET_SIMULATOR_
+
+
+// Engine headers.
+#include <Badger/BadgerFleet.h>
+#include <Simulation/ISimulator.h>
+
+
+/// <summary>
+/// A simulator which drives a BadgerFleet around in circles, this shows how the scene scales with many vehicles and whether instancing
+/// keeps the number of batches down.
+/// </summary>
+class FleetSimulator final : public ISimulator
+{
+    public:
+
+        #pragma region Constructors and destructor
+
+        FleetSimulator();
+
+        FleetSimulator (FleetSimulator&& move);
+        FleetSimulator& operator= (FleetSimulator&& move);
+
+        ~FleetSimulator() override final;
+
+        FleetSimulator (const FleetSimulator& copy)             = delete;
+        FleetSimulator& operator= (const FleetSimulator& copy)  = delete;
+
+        #pragma endregion
+
+        #pragma region ISimulator functionality
+
+        /// <summary> Creates a fleet the size requested by the OgreApplication, instanced when it asks for instancing. </summary>
+        /// <param name="ogre"> The OgreApplication which contains the SceneManager and fleet settings. </param>
+        bool initialise (OgreApplication* const ogre) override final;
+
+        /// <summary> Returns every badger to the grid and sets it driving again. </summary>
+        void reset() override final;
+
+        /// <summary> Steps every badger in the fleet. </summary>
+        /// <param name="deltaTime"> The value in seconds to update the fleet with. </param>
+        void update (const float deltaTime) override final;
+
+        /// <summary> Blends the fleet between the previous and current update. </summary>
+        /// <param name="alpha"> How far between the previous (0.f) and current (1.f) update to render the fleet. </param>
+        void interpolate (const float alpha) override final;
+
+        /// <summary> Publishes the transform of every part of the fleet. </summary>
+        /// <param name="snapshot"> The snapshot being written by the simulation. </param>
+        void publish (TransformSnapshot& snapshot) const override final;
+
+        /// <summary> Appends the state of the fleet. </summary>
+        /// <param name="buffer"> The buffer to append to. </param>
+        void saveState (StateBuffer& buffer) const override final;
+
+        /// <summary> Restores the state of the fleet. </summary>
+        /// <param name="buffer"> The buffer to read from. </param>
+        void restoreState (StateBuffer& buffer) override final;
+
+        #pragma endregion
+
+    private:
+
+        #pragma region Simulation management
+
+        /// <summary> Gives every badger full speed and a turn which varies across the fleet, so they spread out rather than moving as a block. </summary>
+        void setControls();
+
+        #pragma endregion
+
+        #pragma region Implementation data
+
+        BadgerFleet m_fleet {  };   //!< Every badger being driven.
+
+        #pragma endregion
+
+};
+
+#endif // _FLEET_SIMULATOR_
\ No newline at end of file
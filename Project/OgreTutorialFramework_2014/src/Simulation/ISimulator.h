@@ -4,8 +4,26 @@
 #define _ISIMULATOR_
 
 
+// STL headers.
+#include <string>
+#include <vector>
+
+
 // Forward declarations.
 class OgreApplication;
+class StateBuffer;
+struct TransformSnapshot;
+
+
+/// <summary>
+/// The shared resources an ISimulator uses during update(). Simulators which don't conflict are updated concurrently, otherwise they're updated
+/// in the order they were added to the Simulation. Two simulators conflict when either writes a resource which the other reads or writes.
+/// </summary>
+struct SimulatorDependencies final
+{
+    std::vector<std::string>    reads   {  };   //!< The names of resources which are only read, e.g. "Path".
+    std::vector<std::string>    writes  {  };   //!< The names of resources which are modified, e.g. "Console".
+};
 
 
 /// <summary>
@@ -32,6 +50,29 @@ class ISimulator
         /// <param name="deltaTime"> The amount of time in seconds passed since the last update. </param>
         virtual void update (const float deltaTime) {}
 
+        /// <summary> Declares the shared resources used by update(), anything not declared is assumed to be owned by the simulator. </summary>
+        /// <param name="dependencies"> The dependencies to add to. </param>
+        virtual void declareDependencies (SimulatorDependencies& dependencies) const {}
+
+        /// <summary> Blends the visible state of each actor between the previous and current update, this should be called once before rendering. </summary>
+        /// <param name="alpha"> How far between the previous (0.f) and current (1.f) update to render each actor. </param>
+        virtual void interpolate (const float alpha) {}
+
+        /// <summary> Samples any input devices used by the simulator, this is always called by the thread which owns the devices. </summary>
+        virtual void captureInput() {}
+
+        /// <summary> Appends the transform of each moving actor to a snapshot, allowing the simulation to run on a separate thread to rendering. </summary>
+        /// <param name="snapshot"> The snapshot being written by the simulation. </param>
+        virtual void publish (TransformSnapshot& snapshot) const {}
+
+        /// <summary> Appends the complete state of the simulator and its actors so it can be restored without a full reset. </summary>
+        /// <param name="buffer"> The buffer to append to. </param>
+        virtual void saveState (StateBuffer& buffer) const {}
+
+        /// <summary> Restores the state written by saveState(), reading exactly what was written. </summary>
+        /// <param name="buffer"> The buffer to read from. </param>
+        virtual void restoreState (StateBuffer& buffer) {}
+
         #pragma endregion
 
 };
@@ -11,6 +11,8 @@
 // Engine headers.
 #include <Badger/Badger.h>
 #include <Framework/OgreApplication.h>
+#include <Misc/Profiler.h>
+#include <Misc/StateBuffer.h>
 #include <Path/Segment.h>
 #include <Utility/Maths.h>
 #include <Utility/Ogre.h>
@@ -48,6 +50,12 @@ PathSimulator& PathSimulator::operator= (PathSimulator&& move)
 
         m_time = std::move (move.m_time);
         m_timeForSegment = std::move (move.m_timeForSegment);
+        m_timeForLap = std::move (move.m_timeForLap);
+
+        m_lapTimes = std::move (move.m_lapTimes);
+
+        m_fileLocation = std::move (move.m_fileLocation);
+        m_reportSegments = std::move (move.m_reportSegments);
     }
 
     return *this;
@@ -106,7 +114,7 @@ bool PathSimulator::initialise (OgreApplication* const ogre)
 
         // Initialise each required object.
         loadPath (ogre, root);
-        loadBadger (ogre, root);
+        loadBadger (ogre, root, "PathSimulator");
 
         // Reset ourself.
         reset();
@@ -130,6 +138,40 @@ bool PathSimulator::initialise (OgreApplication* const ogre)
 }
 
 
+bool PathSimulator::initialise (Ogre::SceneNode* const root, const std::shared_ptr<Path>& path, const Ogre::String& name)
+{
+    try
+    {
+        // Pre-condition: We have a root node and a path with a valid length.
+        if (!root || !path || path->getLength() <= 0.f)
+        {
+            throw std::invalid_argument ("PathSimulator::initialise(), required parameter is a nullptr or the path hasn't been loaded.");
+        }
+
+        // Share the path and create a badger without any entities.
+        m_path = path;
+        loadBadger (nullptr, root, name);
+
+        // Reset ourself.
+        reset();
+
+        return true;
+    }
+
+    catch (const std::exception& error)
+    {
+        std::cerr << "Exception caught in PathSimulator::initialise(): " << error.what() << std::endl;
+    }
+
+    catch (...)
+    {
+        std::cerr << "An unknown error was caught in PathSimulator::initialise()." << std::endl;
+    }
+
+    return false;
+}
+
+
 void PathSimulator::reset()
 {
     // Start the path again.
@@ -137,16 +179,21 @@ void PathSimulator::reset()
     m_segmentIndex = 0;
     m_time = 0.f;
     m_timeForSegment = 0.f;
+    m_timeForLap = 0.f;
+    m_lapTimes.clear();
 
     // Move the badger to the start point.
     m_badger->reset();
     m_badger->setPosition (m_segment->getPoint (0));
     m_badger->setMaxSpeed (100.f);
+    m_badger->clearInterpolation();
 }
 
 
 void PathSimulator::update (const float deltaTime)
 {    
+    PROFILE_SCOPE ("PathSimulator::update");
+
     /// We can use the length of the tangent vector to normalise the time it takes to move across an arc length. This works by 
     /// calculating the first derivative of a point on the bezier curve (tangent vector), the magnitude represents the speed of
     /// the curve at that point. If we then inverse the magnitude we can increment time by a correct value to maintain a smooth 
@@ -161,11 +208,15 @@ void PathSimulator::update (const float deltaTime)
     /// we don't need to lookup the current distance we're at. Load time is also comparable, we need to segment the curve to
     /// determine the total path/curve length but we save on time by not storing each segments value.
     
+    // Start from the true transform of the badger.
+    m_badger->beginStep();
+
     // We need to calculate the distance we should move each frame based on the desired time to completion.
     const float arcDistancePerFrame { m_path->getLength() / m_timeToComplete * deltaTime };
 
     // We need to update the time it's taken to move across the current segment. This is useful for showing consistency.
     m_timeForSegment += deltaTime;
+    m_timeForLap += deltaTime;
 
     // Increase our time value by a calculated increment.
     m_time += timeIncrement() * arcDistancePerFrame;
@@ -180,7 +231,7 @@ void PathSimulator::update (const float deltaTime)
 
     // Update the badgers position and orientation.
     m_badger->setPosition (position);    
-    m_badger->getNode()->setDirection (tangent, Ogre::Node::TS_WORLD, Ogre::Vector3::UNIT_Z);
+    m_badger->setDirection (tangent, Ogre::Vector3::UNIT_Z);
 
     // Move the badgers wheels. Unfortunately I haven't had time to try and rotate the wheels properly.
     m_badger->revolveWheels (arcDistancePerFrame);
@@ -192,26 +243,89 @@ void PathSimulator::update (const float deltaTime)
     if (m_time >= 1.f)
     {
         // The first segment will when the application starts will be longer than normal because loading times effect deltaTime.
-        std::cout << "Path: " << std::to_string (m_path->getLength())
-                  << ", segment: " << std::to_string (m_segment->getLength()) 
-                  << ", completed: " << std::to_string (m_timeForSegment) << " seconds."<< std::endl;
+        if (m_reportSegments)
+        {
+            std::cout << "Path: " << std::to_string (m_path->getLength())
+                      << ", segment: " << std::to_string (m_segment->getLength()) 
+                      << ", completed: " << std::to_string (m_timeForSegment) << " seconds."<< std::endl;
+        }
 
         // Reset the time counter and obtain the next segment.
         obtainSegment (++m_segmentIndex);
+
+        // A lap is complete when we arrive back at the first segment.
+        if (m_segmentIndex % m_path->getSegmentCount() == 0)
+        {
+            m_lapTimes.push_back (m_timeForLap);
+            m_timeForLap = 0.f;
+        }
+    }
+}
+
+
+void PathSimulator::declareDependencies (SimulatorDependencies& dependencies) const
+{
+    // Many simulators may share the same path but none of them modify it.
+    dependencies.reads.push_back ("Path");
+
+    if (m_reportSegments)
+    {
+        dependencies.writes.push_back ("Console");
     }
 }
 
+
+void PathSimulator::interpolate (const float alpha)
+{
+    m_badger->interpolate (alpha);
+}
+
+
+void PathSimulator::publish (TransformSnapshot& snapshot) const
+{
+    m_badger->publish (snapshot);
+}
+
+
+void PathSimulator::saveState (StateBuffer& buffer) const
+{
+    buffer.write (m_previousTangent);
+    buffer.write (m_segmentIndex);
+    buffer.write (m_time);
+    buffer.write (m_timeForSegment);
+    buffer.write (m_timeForLap);
+    buffer.write (m_lapTimes);
+
+    m_badger->saveState (buffer);
+}
+
+
+void PathSimulator::restoreState (StateBuffer& buffer)
+{
+    buffer.read (m_previousTangent);
+    buffer.read (m_segmentIndex);
+    buffer.read (m_time);
+    buffer.read (m_timeForSegment);
+    buffer.read (m_timeForLap);
+    buffer.read (m_lapTimes);
+
+    // The segment is shared with the path so we look it up rather than storing it.
+    m_segment = m_path->getSegment (m_segmentIndex % m_path->getSegmentCount());
+
+    m_badger->restoreState (buffer);
+}
+
 #pragma endregion
 
 
 #pragma region Initialisation
 
-void PathSimulator::loadBadger (OgreApplication* const ogre, Ogre::SceneNode* const root)
+void PathSimulator::loadBadger (OgreApplication* const ogre, Ogre::SceneNode* const root, const Ogre::String& name)
 {
     // Loading the badger is simple.
     m_badger = std::make_unique<Badger>();
 
-    if (!m_badger->initialise (ogre, root, "PathSimulator"))
+    if (!m_badger->initialise (ogre, root, name))
     {
         throw std::runtime_error ("PathSimulator::loadBadger(), unable to initialise the badger.");
     }
@@ -220,11 +334,16 @@ void PathSimulator::loadBadger (OgreApplication* const ogre, Ogre::SceneNode* co
 
 void PathSimulator::loadPath (OgreApplication* const ogre, Ogre::SceneNode* const root)
 {
-    // Obtain a working xml file location.
-    const auto location = obtainFileLocation();
+    // Obtain a working xml file location, only ask the user if we haven't been given one. Nobody can answer when headless.
+    if (m_fileLocation.empty() && ogre && ogre->IsHeadless())
+    {
+        throw std::runtime_error ("PathSimulator::loadPath(), no path file was given, use --path <file> when running headless.");
+    }
+
+    const auto location = m_fileLocation.empty() ? obtainFileLocation() : m_fileLocation;
 
     // Attempt to initialise the path.
-    m_path = std::make_unique<Path>();
+    m_path = std::make_shared<Path>();
     m_path->setWaypointScale ({ 200.f, 200.f, 200.f });
     
     if (!m_path->loadFromXML (location, ogre, root))
@@ -243,7 +362,12 @@ std::string PathSimulator::obtainFileLocation() const
 
 		// Use std::getline() to allow for spaces in the file location and to allow the use of the string class.
 		std::string location;
-		std::getline (std::cin, location);
+
+		// Asking again would loop forever once the input has been closed.
+		if (!std::getline (std::cin, location))
+		{
+			throw std::runtime_error ("PathSimulator::obtainFileLocation(), the console input was closed before a file location was given.");
+		}
 
 		// Test if the location ends in .xml
 		const size_t ext = location.find_last_of (".");
@@ -6,6 +6,7 @@
 
 // STL headers.
 #include <memory>
+#include <vector>
 
 
 // Engine headers.
@@ -41,7 +42,16 @@ class PathSimulator final : public ISimulator
         #pragma region Getters and settes
 
         /// <summary> Gets the time to complete a full path simulation in seconds. </summary>
-        float getTimeToComplete() const { return m_timeToComplete; }
+        float getTimeToComplete() const                 { return m_timeToComplete; }
+
+        /// <summary> Gets the time in seconds that each completed lap of the path took. </summary>
+        const std::vector<float>& getLapTimes() const   { return m_lapTimes; }
+
+        /// <summary> Sets the location of the XML file to load, this prevents the user being asked for the location. </summary>
+        void setFileLocation (const std::string& location)  { m_fileLocation = location; }
+
+        /// <summary> Sets whether the completion of each segment should be written to the console. </summary>
+        void setReportSegments (const bool report)          { m_reportSegments = report; }
 
         /// <summary> Sets how long it should take in seconds for the path simulation to complete a cycle. </summary>
         /// <param name="time"> Negative values will be made absolute. 0.f is ignored. </param>
@@ -59,6 +69,12 @@ class PathSimulator final : public ISimulator
         /// <param name="ogre"> The OgreApplication which contains the SceneManager required to function. </param>
         bool initialise (OgreApplication* const ogre) override final;
 
+        /// <summary> Initialises a headless simulator which shares an already loaded path, no entities will be created. </summary>
+        /// <param name="root"> The SceneNode to attach the badger to. </param>
+        /// <param name="path"> The loaded path for the badger to follow. </param>
+        /// <param name="name"> The unique name to give the badger. </param>
+        bool initialise (Ogre::SceneNode* const root, const std::shared_ptr<Path>& path, const Ogre::String& name);
+
         /// <summary> Resets the PathSimulator to initial values, completely restarting the PathSimulator. </summary>
         void reset() override final;
 
@@ -66,6 +82,25 @@ class PathSimulator final : public ISimulator
         /// <param name="deltaTime"> The value in seconds to update the PathSimulator with. </param>
         void update (const float deltaTime) override final;
 
+        /// <summary> Declares the resources shared with other simulators. </summary>
+        void declareDependencies (SimulatorDependencies& dependencies) const override final;
+
+        /// <summary> Blends the badger between the previous and current update. </summary>
+        /// <param name="alpha"> How far between the previous (0.f) and current (1.f) update to render the badger. </param>
+        void interpolate (const float alpha) override final;
+
+        /// <summary> Publishes the transform of the badger. </summary>
+        /// <param name="snapshot"> The snapshot being written by the simulation. </param>
+        void publish (TransformSnapshot& snapshot) const override final;
+
+        /// <summary> Appends the state of the PathSimulator and its badger. </summary>
+        /// <param name="buffer"> The buffer to append to. </param>
+        void saveState (StateBuffer& buffer) const override final;
+
+        /// <summary> Restores the state of the PathSimulator and its badger. </summary>
+        /// <param name="buffer"> The buffer to read from. </param>
+        void restoreState (StateBuffer& buffer) override final;
+
         #pragma endregion
 
     private:
@@ -75,7 +110,8 @@ class PathSimulator final : public ISimulator
         /// <summary> Attempts to load the badger ready for the simulation. </summary>
         /// <param name="ogre"> The OgreApplication required to initialise the path object. </param>
         /// <param name="root"> The SceneNode to attach the badger to. </param>
-        void loadBadger (OgreApplication* const ogre, Ogre::SceneNode* const root);
+        /// <param name="name"> The unique name to give the badger. </param>
+        void loadBadger (OgreApplication* const ogre, Ogre::SceneNode* const root, const Ogre::String& name);
 
         /// <summary> Causes the simulator to initialise the path with an XML file. </summary>
         /// <param name="ogre"> The OgreApplication required to initialise the path object. </param>
@@ -102,7 +138,7 @@ class PathSimulator final : public ISimulator
         #pragma region Implmentation data
         
         std::unique_ptr<Badger>                 m_badger            { nullptr };    //!< The badger vehicle used to demonstrate the bezier curve path.
-        std::unique_ptr<Path>                   m_path              { nullptr };    //!< The path which the badger will follow.
+        std::shared_ptr<Path>                   m_path              { nullptr };    //!< The path which the badger will follow, may be shared between headless simulators.
 
         std::shared_ptr<const Path::Segment>    m_segment           { nullptr };    //!< The current segment. Allows for quicker curve calculations.
 
@@ -114,6 +150,12 @@ class PathSimulator final : public ISimulator
 
         float                                   m_time              { 0.f };        //!< The current time value used to track where on the curve we should be.
         float                                   m_timeForSegment    { 0.f };        //!< Keeps track of how long each segment has taken to complete in seconds.
+        float                                   m_timeForLap        { 0.f };        //!< Keeps track of how long the current lap has taken in seconds.
+
+        std::vector<float>                      m_lapTimes          {  };           //!< The time taken for each completed lap of the path.
+
+        std::string                             m_fileLocation      {  };           //!< The XML file to load, the user will be asked for one if this is empty.
+        bool                                    m_reportSegments    { true };       //!< Whether segment completion should be written to the console.
 
         #pragma endregion
 
@@ -4,17 +4,28 @@
 
 // STL headers.
 #include <iostream>
+#include <thread>
 
 
 
 // Engine headers.
+#include <Framework/OgreApplication.h>
+#include <Misc/JobSystem.h>
+#include <Misc/Profiler.h>
 #include <Simulation/BadgerSimulator.h>
+#include <Simulation/FleetSimulator.h>
 #include <Simulation/PathSimulator.h>
+#include <Simulation/SimulatorScheduler.h>
 
 
 
 #pragma region Constructors
 
+Simulation::Simulation()
+{
+}
+
+
 Simulation::Simulation (Simulation&& move)
 {
     *this = std::move (move);
@@ -26,7 +37,10 @@ Simulation& Simulation::operator= (Simulation&& move)
     if (this != &move)
     {
         // Simulation.
-        m_simulators = std::move (m_simulators);
+        m_simulators = std::move (move.m_simulators);
+        m_jobs = std::move (move.m_jobs);
+        m_scheduler = std::move (move.m_scheduler);
+        m_initialState = std::move (move.m_initialState);
     }
 
     return *this;
@@ -35,6 +49,10 @@ Simulation& Simulation::operator= (Simulation&& move)
 
 Simulation::~Simulation()
 {
+    // The workers must stop before the simulators they update are deleted.
+    m_scheduler = nullptr;
+    m_jobs = nullptr;
+
     // Clean up after ourselves.
     for (auto& simulator : m_simulators)
     {
@@ -59,9 +77,22 @@ void Simulation::initialise (OgreApplication* const ogre)
         std::cout << std::endl;
     }
 
-    // Add the simulators.
+    // Add the simulators, the path simulator only asks for a file when we haven't been given one.
+    auto path = new PathSimulator();
+
+    if (ogre)
+    {
+        path->setFileLocation (ogre->GetPathFile());
+    }
+
     m_simulators.push_back (new BadgerSimulator());
-    m_simulators.push_back (new PathSimulator());
+    m_simulators.push_back (path);
+
+    // The fleet is only wanted when stress-testing the scene.
+    if (ogre && ogre->GetFleetSize() > 0)
+    {
+        m_simulators.push_back (new FleetSimulator());
+    }
 
     // Initialise each simulator.
     for (unsigned int i = 0; i < m_simulators.size(); ++i)
@@ -82,11 +113,29 @@ void Simulation::initialise (OgreApplication* const ogre)
             }
         }
     }
+
+    // Spread the simulators over every core except the one we're running on.
+    const unsigned int cores { std::thread::hardware_concurrency() };
+
+    m_jobs = std::make_unique<JobSystem> (cores > 1 ? cores - 1 : 0);
+    m_scheduler = std::make_unique<SimulatorScheduler>();
+    m_scheduler->build (m_simulators, *m_jobs);
+
+    // Resetting is far cheaper as a copy than asking each simulator to set itself up again.
+    saveState (m_initialState);
 }
 
 
 void Simulation::reset()
 {
+    PROFILE_SCOPE ("Simulation::reset");
+
+    if (!m_initialState.isEmpty())
+    {
+        restoreState (m_initialState);
+        return;
+    }
+
     // Inform each simulator to reset itself.
     for (auto simulator : m_simulators)
     {
@@ -98,14 +147,81 @@ void Simulation::reset()
 }
 
 
+void Simulation::saveState (StateBuffer& buffer) const
+{
+    buffer.clear();
+
+    for (auto simulator : m_simulators)
+    {
+        if (simulator)
+        {
+            simulator->saveState (buffer);
+        }
+    }
+}
+
+
+void Simulation::restoreState (StateBuffer& buffer)
+{
+    buffer.rewind();
+
+    // Simulators read back in the same order they were written.
+    for (auto simulator : m_simulators)
+    {
+        if (simulator)
+        {
+            simulator->restoreState (buffer);
+        }
+    }
+}
+
+
 void Simulation::update (const float deltaTime)
 {
-    // Inform each simulator to update itself.
+    PROFILE_SCOPE ("Simulation::update");
+
+    // The scheduler only exists once we've been initialised.
+    if (m_scheduler)
+    {
+        m_scheduler->update (deltaTime);
+    }
+}
+
+
+void Simulation::interpolate (const float alpha)
+{
+    // Inform each simulator to interpolate its actors.
+    for (auto simulator : m_simulators)
+    {
+        if (simulator)
+        {
+            simulator->interpolate (alpha);
+        }
+    }
+}
+
+
+void Simulation::captureInput()
+{
+    // Inform each simulator to sample its input.
+    for (auto simulator : m_simulators)
+    {
+        if (simulator)
+        {
+            simulator->captureInput();
+        }
+    }
+}
+
+
+void Simulation::publish (TransformSnapshot& snapshot) const
+{
+    // Inform each simulator to publish its actors.
     for (auto simulator : m_simulators)
     {
         if (simulator)
         {
-            simulator->update (deltaTime);
+            simulator->publish (snapshot);
         }
     }
 }
@@ -5,12 +5,20 @@
 
 
 // STL headers.
+#include <memory>
 #include <vector>
 
 
+// Engine headers.
+#include <Misc/StateBuffer.h>
+
+
 // Forward declarations.
 class OgreApplication;
 class ISimulator;
+class JobSystem;
+class SimulatorScheduler;
+struct TransformSnapshot;
 
 
 /// <summary>
@@ -22,7 +30,7 @@ class Simulation final
 
         #pragma region Constructors and destruction
 
-        Simulation()                                    = default;
+        Simulation();
 
         Simulation (Simulation&& move);
         Simulation& operator= (Simulation&& move);
@@ -41,20 +49,42 @@ class Simulation final
         /// <returns> Returns whether the initialisation worked or not. </returns>
         void initialise (OgreApplication* const ogre);
 
-        /// <summary> Forces the simulation to completely reset. </summary>
+        /// <summary> Returns the simulation to how it was after initialisation by restoring a snapshot taken at the time. </summary>
         void reset();
 
-        /// <summary> Updates the simulation; this should be called each frame. </summary>
+        /// <summary> Captures the state of every simulator and actor, replacing anything already in the buffer. </summary>
+        /// <param name="buffer"> The buffer to write to, its memory is reused. </param>
+        void saveState (StateBuffer& buffer) const;
+
+        /// <summary> Restores a snapshot captured by saveState(). Nodes are updated by the next interpolation or published snapshot. </summary>
+        /// <param name="buffer"> The buffer to read from, it is rewound first so it can be restored any number of times. </param>
+        void restoreState (StateBuffer& buffer);
+
+        /// <summary> Updates the simulation; this should be called each frame. Independent simulators are updated concurrently. </summary>
         /// <param name="deltaTime"> The amount of time in seconds passed since the last update. </param>
         void update (const float deltaTime);
 
+        /// <summary> Blends every actor between the previous and current update, this should be called once before rendering. </summary>
+        /// <param name="alpha"> How far between the previous (0.f) and current (1.f) update to render each actor. </param>
+        void interpolate (const float alpha);
+
+        /// <summary> Samples the input devices used by each simulator, this must be called by the thread which owns them. </summary>
+        void captureInput();
+
+        /// <summary> Writes the transform of every moving actor to a snapshot so they can be applied by the thread which renders. </summary>
+        /// <param name="snapshot"> The snapshot to write to. </param>
+        void publish (TransformSnapshot& snapshot) const;
+
         #pragma endregion
 
     private:
 
         #pragma region Implementation data
 
-        std::vector<ISimulator*>    m_simulators    { };    //!< A container of each simulator in the application.
+        std::vector<ISimulator*>                m_simulators    { };            //!< A container of each simulator in the application.
+        std::unique_ptr<JobSystem>              m_jobs          { nullptr };    //!< The worker threads shared by everything the simulation runs in parallel.
+        std::unique_ptr<SimulatorScheduler>     m_scheduler     { nullptr };    //!< Updates independent simulators concurrently on the job system.
+        StateBuffer                             m_initialState  {  };           //!< The state of every simulator directly after initialisation, restored by reset().
 
         #pragma endregion
 
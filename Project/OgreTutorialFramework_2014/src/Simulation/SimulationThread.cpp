@@ -0,0 +1,192 @@
+#include "SimulationThread.h"
+
+
+
+// STL headers.
+#include <cmath>
+#include <exception>
+#include <iostream>
+
+
+
+// Engine headers.
+#include <Misc/FramePacer.h>
+#include <Misc/Profiler.h>
+#include <Simulation/Simulation.h>
+#include <Utility/Maths.h>
+
+
+
+#pragma region Constructors and destructor
+
+SimulationThread::SimulationThread (Simulation& simulation, const double stepLength)
+    : m_simulation (simulation), m_stepLength (stepLength)
+{
+}
+
+
+SimulationThread::~SimulationThread()
+{
+    stop();
+}
+
+#pragma endregion
+
+
+#pragma region Getters and setters
+
+void SimulationThread::setTimeScale (const double scale)
+{
+    if (scale > 0.0 && !isRunning())
+    {
+        m_timeScale = scale;
+    }
+}
+
+
+void SimulationThread::setStepBudget (const double seconds)
+{
+    if (!isRunning())
+    {
+        m_stepBudget = util::max (seconds, 0.0);
+    }
+}
+
+
+void SimulationThread::setMaxStepsPerTick (const unsigned int steps)
+{
+    if (!isRunning())
+    {
+        m_maxStepsPerTick = steps;
+    }
+}
+
+#pragma endregion
+
+
+#pragma region Thread control
+
+void SimulationThread::start()
+{
+    if (!m_thread.joinable())
+    {
+        m_epoch = std::chrono::steady_clock::now();
+        m_running.store (true);
+        m_thread = std::thread (&SimulationThread::run, this);
+    }
+}
+
+
+void SimulationThread::stop()
+{
+    m_running.store (false);
+
+    if (m_thread.joinable())
+    {
+        m_thread.join();
+    }
+}
+
+#pragma endregion
+
+
+#pragma region Render thread interface
+
+void SimulationThread::apply()
+{
+    const auto& snapshot = m_transforms.acquire();
+
+    // Each snapshot holds the last two steps so we display it one step late, blending towards the newest step as time passes.
+    const float alpha { static_cast<float> ((now() - snapshot.time) * m_timeScale / m_stepLength) };
+
+    snapshot.apply (util::clamp (alpha, 0.f, 1.f));
+}
+
+#pragma endregion
+
+
+#pragma region Helper functions
+
+void SimulationThread::run()
+{
+    PROFILE_THREAD_NAME ("Simulation");
+
+    try
+    {
+        // The pacer sleeps between ticks so we don't spin a core whilst waiting.
+        FramePacer  pacer           {  };
+        const float deltaTime       { static_cast<float> (m_stepLength) };
+        double      timeToUpdate    { 0.0 };
+
+        // Tick at the step rate in real time, fast-forwarding just performs more steps each tick.
+        pacer.setTargetFrameRate (1.0 / m_stepLength);
+        pacer.start();
+
+        while (m_running.load())
+        {
+            timeToUpdate += pacer.beginFrame() * m_timeScale;
+
+            const double    tickStart   { now() };
+            unsigned int    steps       { 0 };
+
+            // Always step by a fixed amount so simulated time matches scaled real time, unless the cap or budget is reached.
+            while (timeToUpdate >= m_stepLength && (m_maxStepsPerTick == 0 || steps < m_maxStepsPerTick))
+            {
+                if (m_stepBudget > 0.0 && now() - tickStart >= m_stepBudget)
+                {
+                    break;
+                }
+
+                if (m_resetRequested.exchange (false))
+                {
+                    m_simulation.reset();
+                }
+
+                m_simulation.update (deltaTime);
+                timeToUpdate -= m_stepLength;
+                ++steps;
+                ++m_steps;
+            }
+
+            m_stepTime += static_cast<unsigned long> ((now() - tickStart) * 1000000.0);
+
+            // If we've fallen too far behind drop the backlog instead of spiralling, the simulation will slow down instead.
+            if (timeToUpdate >= m_stepLength)
+            {
+                timeToUpdate = std::fmod (timeToUpdate, m_stepLength);
+            }
+
+            // Publish the result, the render thread picks up whichever snapshot is newest.
+            if (steps != 0)
+            {
+                auto& snapshot = m_transforms.beginWrite();
+
+                m_simulation.publish (snapshot);
+                snapshot.step = m_steps.load();
+                snapshot.time = now();
+
+                m_transforms.publish();
+            }
+        }
+    }
+
+    catch (const std::exception& error)
+    {
+        std::cerr << "An exception was caught in SimulationThread::run(): " << error.what() << std::endl;
+    }
+
+    catch (...)
+    {
+        std::cerr << "An unknown error occurred in SimulationThread::run()." << std::endl;
+    }
+
+    m_running.store (false);
+}
+
+
+double SimulationThread::now() const
+{
+    return std::chrono::duration<double> (std::chrono::steady_clock::now() - m_epoch).count();
+}
+
+#pragma endregion
\ No newline at end of file
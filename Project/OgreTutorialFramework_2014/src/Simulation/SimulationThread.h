@@ -0,0 +1,129 @@
+#pragma once
+
+#ifndef _SIMULATION_THREAD_
+#define _SIMULATION_THREAD_
+
+
+// STL headers.
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+
+// Engine headers.
+#include <Misc/TransformBuffer.h>
+
+
+// Forward declarations.
+class Simulation;
+
+
+/// <summary>
+/// Steps a Simulation at a fixed rate on its own thread. The thread ticks at the step rate and performs as many steps as scaled real time requires,
+/// within the step cap and budget. After each tick the transform of every moving actor is published to a triple buffer which the render thread
+/// applies to the SceneNodes before rendering, the simulation itself never touches the scene graph.
+/// </summary>
+class SimulationThread final
+{
+    public:
+
+        #pragma region Constructors and destructor
+
+        /// <summary> Prepares the thread without starting it. </summary>
+        /// <param name="simulation"> The initialised simulation to step, this must outlive the thread. </param>
+        /// <param name="stepLength"> The fixed simulation step in seconds. </param>
+        SimulationThread (Simulation& simulation, const double stepLength);
+
+        /// <summary> Stops the thread if it's still running. </summary>
+        ~SimulationThread();
+
+        SimulationThread (SimulationThread&& move)                  = delete;
+        SimulationThread& operator= (SimulationThread&& move)       = delete;
+        SimulationThread (const SimulationThread& copy)             = delete;
+        SimulationThread& operator= (const SimulationThread& copy)  = delete;
+
+        #pragma endregion
+
+        #pragma region Getters and setters
+
+        /// <summary> Checks whether the simulation thread is currently running. </summary>
+        bool isRunning() const                      { return m_running.load(); }
+
+        /// <summary> Gets the number of steps simulated since the thread was started. </summary>
+        unsigned long getStepCount() const          { return m_steps.load(); }
+
+        /// <summary> Gets the total microseconds spent stepping on the simulation thread, it wraps around so only use the difference of two readings. </summary>
+        unsigned long getStepTime() const           { return m_stepTime.load(); }
+
+        /// <summary> Gets how many seconds are simulated per real second. </summary>
+        double getTimeScale() const                 { return m_timeScale; }
+
+        /// <summary> Sets how many seconds are simulated per real second, this must be set before the thread is started. </summary>
+        /// <param name="scale"> Values of 0.0 or less are ignored. If a step takes longer than the scaled step the thread simply runs flat out. </param>
+        void setTimeScale (const double scale);
+
+        /// <summary> Limits how long each tick may spend stepping, any backlog left when it runs out is dropped. This must be set before the thread is started. </summary>
+        /// <param name="seconds"> Values of 0.0 or less remove the budget. </param>
+        void setStepBudget (const double seconds);
+
+        /// <summary> Limits how many steps each tick may perform whilst catching up, this must be set before the thread is started. </summary>
+        /// <param name="steps"> 0 removes the cap. </param>
+        void setMaxStepsPerTick (const unsigned int steps);
+
+        #pragma endregion
+
+        #pragma region Thread control
+
+        /// <summary> Starts stepping the simulation, nothing happens if it's already running. </summary>
+        void start();
+
+        /// <summary> Stops stepping the simulation and waits for the current step to finish. </summary>
+        void stop();
+
+        /// <summary> Asks the simulation to reset before its next step, this can be called from any thread. </summary>
+        void requestReset()                         { m_resetRequested.store (true); }
+
+        #pragma endregion
+
+        #pragma region Render thread interface
+
+        /// <summary> Applies the most recently published transforms to the SceneNodes, interpolating to hide the difference between the step and frame rate. </summary>
+        void apply();
+
+        #pragma endregion
+
+    private:
+
+        #pragma region Helper functions
+
+        /// <summary> The body of the simulation thread. </summary>
+        void run();
+
+        /// <summary> Gets the time in seconds since the thread was started, this is safe to call from any thread. </summary>
+        double now() const;
+
+        #pragma endregion
+
+        #pragma region Implementation data
+
+        Simulation&                             m_simulation;                   //!< The simulation being stepped.
+        double                                  m_stepLength        { 0.0 };    //!< The fixed simulation step in seconds.
+        double                                  m_timeScale         { 1.0 };    //!< How many seconds are simulated per real second.
+        double                                  m_stepBudget        { 0.0 };    //!< The most time in seconds each tick may spend stepping, 0 if unlimited.
+        unsigned int                            m_maxStepsPerTick   { 0 };      //!< The most steps each tick may perform, 0 if unlimited.
+
+        TransformBuffer                         m_transforms        {  };       //!< The snapshots shared between the simulation and render thread.
+
+        std::thread                             m_thread            {  };       //!< The thread stepping the simulation.
+        std::atomic<bool>                       m_running           { false };  //!< Whether the thread should continue stepping.
+        std::atomic<bool>                       m_resetRequested    { false };  //!< Whether the simulation should reset before its next step.
+        std::atomic<unsigned long>              m_steps             { 0 };      //!< The number of steps simulated.
+        std::atomic<unsigned long>              m_stepTime          { 0 };      //!< The microseconds spent stepping, excluding sleeping and publishing.
+
+        std::chrono::steady_clock::time_point   m_epoch             {  };       //!< When the thread was started, snapshot times are relative to this.
+
+        #pragma endregion
+
+};
+
+#endif // _SIMULATION_THREAD_
\ No newline at end of file
@@ -0,0 +1,173 @@
+#include "SimulatorScheduler.h"
+
+
+
+// STL headers.
+#include <algorithm>
+#include <utility>
+
+
+
+// Engine headers.
+#include <Utility/Maths.h>
+
+
+
+// Helper functions.
+
+/// <summary> Checks whether two lists of resource names share any entry. </summary>
+static bool overlaps (const std::vector<std::string>& lhs, const std::vector<std::string>& rhs)
+{
+    for (const auto& resource : lhs)
+    {
+        if (std::find (rhs.cbegin(), rhs.cend(), resource) != rhs.cend())
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+
+/// <summary> Checks whether two simulators can't safely update at the same time. </summary>
+static bool conflicts (const SimulatorDependencies& first, const SimulatorDependencies& second)
+{
+    return  overlaps (first.writes, second.writes) ||
+            overlaps (first.writes, second.reads) ||
+            overlaps (first.reads, second.writes);
+}
+
+
+
+#pragma region Public interface
+
+void SimulatorScheduler::build (const std::vector<ISimulator*>& simulators, JobSystem& jobs)
+{
+    m_jobs = &jobs;
+    m_tasks.clear();
+
+    // Gather the dependencies of each valid simulator.
+    for (const auto simulator : simulators)
+    {
+        if (simulator)
+        {
+            Task task {  };
+            task.simulator = simulator;
+            simulator->declareDependencies (task.declared);
+
+            m_tasks.push_back (std::move (task));
+        }
+    }
+
+    // Atomics can't be copied so the counters are replaced rather than resized.
+    m_remaining = std::vector<std::atomic<unsigned int>> (m_tasks.size());
+
+    connectTasks();
+}
+
+
+void SimulatorScheduler::update (const float deltaTime)
+{
+    // Simulators may have changed what they use since the last update, e.g. PathSimulator::setReportSegments().
+    refreshDependencies();
+
+    m_deltaTime = deltaTime;
+
+    for (unsigned int i = 0; i < m_tasks.size(); ++i)
+    {
+        m_remaining[i].store (m_tasks[i].dependencies, std::memory_order_relaxed);
+    }
+
+    // Queue each task without dependencies, the rest are queued as their dependencies finish. The group only finishes once every queued
+    // task has, including those queued by other tasks, so waiting on it here waits for the whole graph.
+    JobSystem::TaskGroup group {  };
+
+    for (unsigned int i = 0; i < m_tasks.size(); ++i)
+    {
+        if (m_tasks[i].dependencies == 0)
+        {
+            launch (group, i);
+        }
+    }
+
+    m_jobs->wait (group);
+}
+
+#pragma endregion
+
+
+#pragma region Helper functions
+
+void SimulatorScheduler::refreshDependencies()
+{
+    bool changed { false };
+
+    for (auto& task : m_tasks)
+    {
+        m_scratch.reads.clear();
+        m_scratch.writes.clear();
+        task.simulator->declareDependencies (m_scratch);
+
+        if (m_scratch.reads != task.declared.reads || m_scratch.writes != task.declared.writes)
+        {
+            std::swap (task.declared, m_scratch);
+            changed = true;
+        }
+    }
+
+    if (changed)
+    {
+        connectTasks();
+    }
+}
+
+
+void SimulatorScheduler::connectTasks()
+{
+    for (auto& task : m_tasks)
+    {
+        task.dependents.clear();
+        task.dependencies = 0;
+    }
+
+    // Each task must wait for every earlier task it conflicts with, this preserves the original order wherever it matters.
+    std::vector<unsigned int> depth (m_tasks.size(), 1);
+    m_criticalPath = m_tasks.empty() ? 0 : 1;
+
+    for (unsigned int later = 0; later < m_tasks.size(); ++later)
+    {
+        for (unsigned int earlier = 0; earlier < later; ++earlier)
+        {
+            if (conflicts (m_tasks[earlier].declared, m_tasks[later].declared))
+            {
+                m_tasks[earlier].dependents.push_back (later);
+                ++m_tasks[later].dependencies;
+
+                depth[later] = util::max (depth[later], depth[earlier] + 1);
+            }
+        }
+
+        m_criticalPath = util::max (m_criticalPath, depth[later]);
+    }
+}
+
+
+void SimulatorScheduler::launch (JobSystem::TaskGroup& group, const unsigned int index)
+{
+    m_jobs->run (group, [this, &group, index] ()
+    {
+        m_tasks[index].simulator->update (m_deltaTime);
+
+        // Whichever dependency finishes last queues the dependent, the release makes this update visible to it.
+        for (const auto dependent : m_tasks[index].dependents)
+        {
+            if (m_remaining[dependent].fetch_sub (1, std::memory_order_acq_rel) == 1)
+            {
+                launch (group, dependent);
+            }
+        }
+    });
+}
+
+#pragma endregion
\ No newline at end of file
@@ -0,0 +1,105 @@
+#pragma once
+
+#ifndef _SIMULATOR_SCHEDULER_
+#define _SIMULATOR_SCHEDULER_
+
+
+// STL headers.
+#include <atomic>
+#include <vector>
+
+
+// Engine headers.
+#include <Misc/JobSystem.h>
+#include <Simulation/ISimulator.h>
+
+
+/// <summary>
+/// Updates a collection of ISimulator objects as jobs on a JobSystem. The dependencies declared by each simulator form a graph so that
+/// independent simulators run concurrently whilst conflicting simulators keep the order they were given in. Each simulator is queued by
+/// the last of its dependencies to finish and the calling thread runs jobs whilst it waits, so the time taken is the critical path of the
+/// graph rather than the sum of every simulator. Dependencies are declared again before each update and the graph is rebuilt whenever
+/// they've changed.
+/// </summary>
+class SimulatorScheduler final
+{
+    public:
+
+        #pragma region Constructors and destructor
+
+        SimulatorScheduler()                                            = default;
+        ~SimulatorScheduler()                                           = default;
+
+        SimulatorScheduler (SimulatorScheduler&& move)                  = delete;
+        SimulatorScheduler& operator= (SimulatorScheduler&& move)       = delete;
+        SimulatorScheduler (const SimulatorScheduler& copy)             = delete;
+        SimulatorScheduler& operator= (const SimulatorScheduler& copy)  = delete;
+
+        #pragma endregion
+
+        #pragma region Getters and setters
+
+        /// <summary> Gets the number of simulators on the longest chain of dependencies, the best case for the number of sequential updates. </summary>
+        unsigned int getCriticalPathLength() const  { return m_criticalPath; }
+
+        #pragma endregion
+
+        #pragma region Public interface
+
+        /// <summary> Builds the dependency graph, this should be called whenever the set of simulators changes. </summary>
+        /// <param name="simulators"> The simulators to update in their preferred order, nullptr entries are ignored. </param>
+        /// <param name="jobs"> The threads each simulator is updated on, this must outlive the scheduler. </param>
+        void build (const std::vector<ISimulator*>& simulators, JobSystem& jobs);
+
+        /// <summary>
+        /// Updates every simulator and waits for them to finish. Any exception thrown by a simulator is rethrown on the calling thread, the
+        /// simulators which depend on it aren't updated.
+        /// </summary>
+        /// <param name="deltaTime"> The amount of time in seconds passed since the last update. </param>
+        void update (const float deltaTime);
+
+        #pragma endregion
+
+    private:
+
+        /// <summary>
+        /// A single simulator and its position in the dependency graph.
+        /// </summary>
+        struct Task final
+        {
+            ISimulator*                 simulator       { nullptr };    //!< The simulator to update.
+            SimulatorDependencies       declared        {  };           //!< The resources the simulator used when the graph was built.
+            std::vector<unsigned int>   dependents      {  };           //!< The tasks which can't start until this one finishes.
+            unsigned int                dependencies    { 0 };          //!< How many tasks must finish before this one can start.
+        };
+
+        #pragma region Helper functions
+
+        /// <summary> Asks each simulator for its dependencies again, rebuilding the graph if any have changed. </summary>
+        void refreshDependencies();
+
+        /// <summary> Links each task to every earlier task it conflicts with and measures the critical path. </summary>
+        void connectTasks();
+
+        /// <summary> Queues a task as part of the update, queueing each dependent once its final dependency has finished. </summary>
+        /// <param name="group"> The group the update waits on. </param>
+        /// <param name="index"> The task to queue. </param>
+        void launch (JobSystem::TaskGroup& group, const unsigned int index);
+
+        #pragma endregion
+
+        #pragma region Implementation data
+
+        std::vector<Task>                       m_tasks         {  };           //!< Every task in the order they were given.
+        unsigned int                            m_criticalPath  { 0 };          //!< The length of the longest chain of dependencies.
+        SimulatorDependencies                   m_scratch       {  };           //!< Reused when checking for changed dependencies.
+
+        JobSystem*                              m_jobs          { nullptr };    //!< Runs every update, the same threads are shared with the rest of the application.
+        std::vector<std::atomic<unsigned int>>  m_remaining     {  };           //!< How many dependencies of each task are yet to finish during the current update.
+        float                                   m_deltaTime     { 0.f };        //!< The delta time of the current update.
+
+        #pragma endregion
+
+};
+
+#endif // _SIMULATOR_SCHEDULER_
\ No newline at end of file
@@ -5,33 +5,6 @@
 namespace util
 {
 
-    #pragma region Miscellaneous
-
-    float fixYaw (const float yaw, const float limit)
-    {
-        // Obtain a copy of PI.
-        const float pi = Ogre::Math::PI;
-
-        // Create a temporary result.
-        float result = yaw;
-
-        if (yaw >= limit)
-        {
-            result = -pi + yaw;
-        }
-
-        else if (yaw <= -limit)
-        {
-            result = pi + yaw;
-        }
-
-        // Return the calculated value.
-        return clamp (result, -limit, limit);
-    }
-
-    #pragma endregion
-
-
     #pragma region Rotation functions
 
     Ogre::Matrix3 rotationMatrix (const Ogre::Vector3& orientation)
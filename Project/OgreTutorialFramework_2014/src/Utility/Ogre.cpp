@@ -2,6 +2,199 @@
 
 
 
+// STL headers.
+#include <algorithm>
+#include <stdexcept>
+
+
+
+// Engine headers.
+#include <Framework/OgreApplication.h>
+#include <Rendering/NullRenderer.h>
+#include <Rendering/ResourceCache.h>
+#include <Utility/Maths.h>
+
+
+
+// Globals.
+const Ogre::String instancingProgram    { "BadgerInstancing" };     //!< The prefix given to the vertex and fragment programs used by instanced materials.
+
+/// <summary> Basic hardware instancing passes the 3x4 world matrix of each instance in the texture coordinates following the mesh's own. </summary>
+const Ogre::String hlslSource           { R"(
+void main_vs (float4 position : POSITION, float2 uv : TEXCOORD0, float4 world0 : TEXCOORD1, float4 world1 : TEXCOORD2, float4 world2 : TEXCOORD3,
+              uniform float4x4 viewProjMatrix, out float4 oPosition : POSITION, out float2 oUv : TEXCOORD0)
+{
+    oPosition = mul (viewProjMatrix, float4 (dot (world0, position), dot (world1, position), dot (world2, position), 1.0));
+    oUv = uv;
+}
+
+float4 main_ps (float2 uv : TEXCOORD0, uniform sampler2D diffuseMap : register (s0)) : COLOR
+{
+    return tex2D (diffuseMap, uv);
+}
+)" };
+
+const Ogre::String glslVertexSource     { R"(
+#version 120
+attribute vec4 vertex;
+attribute vec4 uv0;
+attribute vec4 uv1;
+attribute vec4 uv2;
+attribute vec4 uv3;
+uniform mat4 viewProjMatrix;
+varying vec2 texCoord;
+
+void main()
+{
+    gl_Position = viewProjMatrix * vec4 (dot (uv1, vertex), dot (uv2, vertex), dot (uv3, vertex), 1.0);
+    texCoord = uv0.xy;
+}
+)" };
+
+const Ogre::String glslFragmentSource   { R"(
+#version 120
+uniform sampler2D diffuseMap;
+varying vec2 texCoord;
+
+void main()
+{
+    gl_FragColor = texture2D (diffuseMap, texCoord);
+}
+)" };
+
+
+/// <summary> An element of the vertex layout used by merged meshes, positions always come first. </summary>
+struct MergedElement final
+{
+    Ogre::VertexElementSemantic semantic;   //!< What the element holds.
+    Ogre::VertexElementType     type;       //!< The type written to the merged vertex buffer.
+    std::size_t                 start;      //!< The offset of the element in floats.
+    std::size_t                 count;      //!< How many floats the element uses.
+};
+
+const MergedElement mergedElements[]    { { Ogre::VES_POSITION, Ogre::VET_FLOAT3, 0, 3 },
+                                          { Ogre::VES_NORMAL, Ogre::VET_FLOAT3, 3, 3 },
+                                          { Ogre::VES_TEXTURE_COORDINATES, Ogre::VET_FLOAT2, 6, 2 } };
+
+const std::size_t   mergedElementCount  { sizeof (mergedElements) / sizeof (mergedElements[0]) };  //!< The number of elements in a merged vertex.
+const std::size_t   mergedFloats        { 8 };                                                      //!< The number of floats in a merged vertex.
+
+
+
+// Helper functions.
+
+/// <summary> Appends the triangles of a sub-mesh to the merged vertices and indices, moving every position by the offset. </summary>
+static void appendSubMesh (const Ogre::Mesh& mesh, const Ogre::SubMesh& subMesh, const Ogre::Vector3& offset,
+                           std::vector<float>& vertices, std::vector<Ogre::uint32>& indices)
+{
+    if (subMesh.operationType != Ogre::RenderOperation::OT_TRIANGLE_LIST)
+    {
+        throw std::runtime_error ("util::mergeMeshes(), only triangle lists can be merged.");
+    }
+
+    const auto&         data    = subMesh.useSharedVertices ? *mesh.sharedVertexData : *subMesh.vertexData;
+    const std::size_t   first   { vertices.size() / mergedFloats };
+
+    vertices.resize (vertices.size() + data.vertexCount * mergedFloats, 0.f);
+
+    // Copy each element of the merged layout, missing or non-float elements are left as zero.
+    for (std::size_t i = 0; i < mergedElementCount; ++i)
+    {
+        const auto element = data.vertexDeclaration->findElementBySemantic (mergedElements[i].semantic);
+
+        if (!element || Ogre::VertexElement::getBaseType (element->getType()) != Ogre::VET_FLOAT1)
+        {
+            continue;
+        }
+
+        const std::size_t   count   { util::min (static_cast<std::size_t> (Ogre::VertexElement::getTypeCount (element->getType())), mergedElements[i].count) };
+        const auto          buffer  = data.vertexBufferBinding->getBuffer (element->getSource());
+        auto                vertex  = static_cast<unsigned char*> (buffer->lock (Ogre::HardwareBuffer::HBL_READ_ONLY)) + data.vertexStart * buffer->getVertexSize();
+
+        for (std::size_t v = 0; v < data.vertexCount; ++v, vertex += buffer->getVertexSize())
+        {
+            float* value { nullptr };
+            element->baseVertexPointerToElement (vertex, &value);
+
+            std::copy (value, value + count, vertices.begin() + (first + v) * mergedFloats + mergedElements[i].start);
+        }
+
+        buffer->unlock();
+    }
+
+    // Rigid parts are only ever translated relative to the chassis, normals are unaffected.
+    for (std::size_t v = first; v < vertices.size() / mergedFloats; ++v)
+    {
+        vertices[v * mergedFloats + 0] += offset.x;
+        vertices[v * mergedFloats + 1] += offset.y;
+        vertices[v * mergedFloats + 2] += offset.z;
+    }
+
+    // Indices are rebased onto the merged vertices.
+    const auto& indexData   = *subMesh.indexData;
+    const auto  source      = indexData.indexBuffer->lock (Ogre::HardwareBuffer::HBL_READ_ONLY);
+
+    for (std::size_t i = indexData.indexStart; i < indexData.indexStart + indexData.indexCount; ++i)
+    {
+        const std::size_t index { indexData.indexBuffer->getType() == Ogre::HardwareIndexBuffer::IT_32BIT ?
+                                  static_cast<const Ogre::uint32*> (source)[i] : static_cast<const Ogre::uint16*> (source)[i] };
+
+        indices.push_back (static_cast<Ogre::uint32> (first + index));
+    }
+
+    indexData.indexBuffer->unlock();
+}
+
+
+/// <summary> Direct3D 9 supports HLSL whereas OpenGL supports GLSL, the two are never both available. </summary>
+static bool isHLSL()
+{
+    return Ogre::HighLevelGpuProgramManager::getSingleton().isLanguageSupported ("hlsl");
+}
+
+
+/// <summary> Compiles the instancing programs the first time they're needed, choosing HLSL or GLSL to suit the render system. </summary>
+static void createInstancingPrograms()
+{
+    auto& manager = Ogre::HighLevelGpuProgramManager::getSingleton();
+
+    if (!manager.getByName (instancingProgram + "/VS").isNull())
+    {
+        return;
+    }
+
+    const auto& group = Ogre::ResourceGroupManager::DEFAULT_RESOURCE_GROUP_NAME;
+
+    const bool  hlsl        { isHLSL() };
+    const auto  language    = hlsl ? "hlsl" : "glsl";
+
+    const auto  vertex      = manager.createProgram (instancingProgram + "/VS", group, language, Ogre::GPT_VERTEX_PROGRAM),
+                fragment    = manager.createProgram (instancingProgram + "/FS", group, language, Ogre::GPT_FRAGMENT_PROGRAM);
+
+    if (hlsl)
+    {
+        // Direct3D 9 only supports instancing from shader model 3 onwards.
+        vertex->setSource (hlslSource);
+        vertex->setParameter ("entry_point", "main_vs");
+        vertex->setParameter ("target", "vs_3_0");
+
+        fragment->setSource (hlslSource);
+        fragment->setParameter ("entry_point", "main_ps");
+        fragment->setParameter ("target", "ps_3_0");
+    }
+
+    else
+    {
+        vertex->setSource (glslVertexSource);
+        fragment->setSource (glslFragmentSource);
+    }
+
+    vertex->load();
+    fragment->load();
+}
+
+
+
 namespace util
 {
     void createMaterial (const Ogre::String& materialName, const Ogre::String& textureName)
@@ -21,4 +214,161 @@ namespace util
             textureUnit->setTextureCoordSet (0);            
         }
     }
+
+
+    void createInstancedMaterial (const Ogre::String& materialName, const Ogre::String& textureName)
+    {
+        auto& manager = Ogre::MaterialManager::getSingleton();
+
+        if (manager.getByName (materialName).isNull())
+        {
+            createInstancingPrograms();
+
+            const auto material = manager.create (materialName, Ogre::ResourceGroupManager::DEFAULT_RESOURCE_GROUP_NAME);
+            const auto pass = material->getTechnique (0)->getPass (0);
+
+            pass->setVertexProgram (instancingProgram + "/VS");
+            pass->getVertexProgramParameters()->setNamedAutoConstant ("viewProjMatrix", Ogre::GpuProgramParameters::ACT_VIEWPROJ_MATRIX);
+
+            pass->setFragmentProgram (instancingProgram + "/FS");
+
+            // HLSL binds the sampler to a register, GLSL has to be told which texture unit to use.
+            if (!isHLSL())
+            {
+                pass->getFragmentProgramParameters()->setNamedConstant ("diffuseMap", 0);
+            }
+
+            auto textureUnit = pass->createTextureUnitState();
+            textureUnit->setTextureName (textureName, Ogre::TEX_TYPE_2D);
+            textureUnit->setTextureCoordSet (0);
+        }
+    }
+
+
+    Ogre::MovableObject* createEntity (OgreApplication* const ogre, const Ogre::String& mesh, const Ogre::String& material)
+    {
+        // Headless objects have no visual representation.
+        if (!ogre)
+        {
+            return nullptr;
+        }
+
+        // Without a render system we can only record that the mesh would be drawn.
+        if (const auto nullRenderer = ogre->GetNullRenderer())
+        {
+            return nullRenderer->createDrawable (mesh, material);
+        }
+
+        // Create the entity from the cached mesh so it isn't looked up again for every badger.
+        auto& cache = ogre->GetResourceCache();
+        auto entity = ogre->GetSceneManager()->createEntity (cache.getMesh (mesh));
+        entity->setCastShadows (false);
+
+        // Set the material to be used, materials which don't exist yet are left for Ogre to report.
+        const auto cachedMaterial = cache.getMaterial (material);
+
+        if (!cachedMaterial.isNull())
+        {
+            entity->setMaterial (cachedMaterial);
+        }
+
+        else
+        {
+            entity->setMaterialName (material);
+        }
+
+        return entity;
+    }
+
+
+    bool mergeMeshes (OgreApplication* const ogre, const Ogre::String& name, const std::vector<MeshPart>& parts, const Ogre::String& material)
+    {
+        // Drawables are only named after a mesh so the null render backend has nothing to merge.
+        if (!ogre || ogre->GetNullRenderer())
+        {
+            return false;
+        }
+
+        auto& manager = Ogre::MeshManager::getSingleton();
+
+        if (manager.resourceExists (name))
+        {
+            return true;
+        }
+
+        // Gather every triangle into one layout so the merged mesh is a single sub-mesh and therefore a single batch.
+        std::vector<float>          vertices    {  };
+        std::vector<Ogre::uint32>   indices     {  };
+        Ogre::AxisAlignedBox        bounds      {  };
+
+        for (const auto& part : parts)
+        {
+            const auto source = manager.load (part.mesh, Ogre::ResourceGroupManager::AUTODETECT_RESOURCE_GROUP_NAME);
+
+            // Static buffers are write-only, a shadow copy in system memory is needed to read them back.
+            if (!source->isVertexBufferShadowed() || !source->isIndexBufferShadowed())
+            {
+                source->setVertexBufferPolicy (source->getVertexBufferUsage(), true);
+                source->setIndexBufferPolicy (source->getIndexBufferUsage(), true);
+                source->reload();
+            }
+
+            for (unsigned short i = 0; i < source->getNumSubMeshes(); ++i)
+            {
+                appendSubMesh (*source, *source->getSubMesh (i), part.offset, vertices, indices);
+            }
+
+            bounds.merge ({ source->getBounds().getMinimum() + part.offset, source->getBounds().getMaximum() + part.offset });
+        }
+
+        const std::size_t   vertexCount { vertices.size() / mergedFloats };
+        auto&               buffers     = Ogre::HardwareBufferManager::getSingleton();
+
+        auto vertexData = OGRE_NEW Ogre::VertexData();
+        vertexData->vertexStart = 0;
+        vertexData->vertexCount = vertexCount;
+
+        for (std::size_t i = 0; i < mergedElementCount; ++i)
+        {
+            vertexData->vertexDeclaration->addElement (0, mergedElements[i].start * sizeof (float), mergedElements[i].type, mergedElements[i].semantic);
+        }
+
+        const auto vertexBuffer = buffers.createVertexBuffer (mergedFloats * sizeof (float), vertexCount, Ogre::HardwareBuffer::HBU_STATIC_WRITE_ONLY);
+        vertexBuffer->writeData (0, vertexBuffer->getSizeInBytes(), vertices.data(), true);
+        vertexData->vertexBufferBinding->setBinding (0, vertexBuffer);
+
+        // Small meshes keep 16-bit indices as older cards handle them better.
+        const bool  wide        { vertexCount > 0xFFFF };
+        const auto  indexBuffer = buffers.createIndexBuffer (wide ? Ogre::HardwareIndexBuffer::IT_32BIT : Ogre::HardwareIndexBuffer::IT_16BIT,
+                                                             indices.size(), Ogre::HardwareBuffer::HBU_STATIC_WRITE_ONLY);
+
+        if (wide)
+        {
+            indexBuffer->writeData (0, indexBuffer->getSizeInBytes(), indices.data(), true);
+        }
+
+        else
+        {
+            const std::vector<Ogre::uint16> narrow { indices.begin(), indices.end() };
+            indexBuffer->writeData (0, indexBuffer->getSizeInBytes(), narrow.data(), true);
+        }
+
+        const auto merged   = manager.createManual (name, Ogre::ResourceGroupManager::DEFAULT_RESOURCE_GROUP_NAME);
+        const auto subMesh  = merged->createSubMesh();
+
+        subMesh->useSharedVertices = false;
+        subMesh->operationType = Ogre::RenderOperation::OT_TRIANGLE_LIST;
+        subMesh->vertexData = vertexData;
+        subMesh->indexData->indexBuffer = indexBuffer;
+        subMesh->indexData->indexStart = 0;
+        subMesh->indexData->indexCount = indices.size();
+        subMesh->setMaterialName (material);
+
+        // The bounding sphere is centred on the origin of the mesh so it must reach the furthest corner.
+        merged->_setBounds (bounds);
+        merged->_setBoundingSphereRadius (util::max (bounds.getMinimum().length(), bounds.getMaximum().length()));
+        merged->load();
+
+        return true;
+    }
 }
\ No newline at end of file
@@ -4,12 +4,53 @@
 #define _UTIL_OGRE_
 
 
+// STL headers.
+#include <vector>
+
+
+// Forward declarations.
+class OgreApplication;
+
+
 namespace util
 {
     /// <summary> Creates a new material based on the information given, this can then be used by entities. </summary>
     /// <param name="materialName"> The name the material should be referenced by. </param>
     /// <param name="textureName"> The name of the texture file to apply to the material. </param>
     void createMaterial (const Ogre::String& materialName, const Ogre::String& textureName);
+
+    /// <summary>
+    /// Creates a textured material for hardware instancing. Every technique of Ogre's InstanceManager needs a vertex program which reads the
+    /// world matrix of each instance, so unlike createMaterial() this compiles a small HLSL or GLSL program depending on the render system.
+    /// </summary>
+    /// <param name="materialName"> The name the material should be referenced by. </param>
+    /// <param name="textureName"> The name of the texture file to apply to the material. </param>
+    void createInstancedMaterial (const Ogre::String& materialName, const Ogre::String& textureName);
+
+    /// <summary> Creates the visual object for a mesh. When the null render backend is used a NullDrawable is created instead. </summary>
+    /// <param name="ogre"> The OgreApplication used for creating entities. A nullptr indicates that nothing should be created. </param>
+    /// <param name="mesh"> The filename for the mesh to be used. </param>
+    /// <param name="material"> The material name to use for the entity. </param>
+    /// <returns> The object ready to be attached to a SceneNode, a nullptr if no OgreApplication was given. </returns>
+    Ogre::MovableObject* createEntity (OgreApplication* const ogre, const Ogre::String& mesh, const Ogre::String& material);
+
+    /// <summary> A mesh to merge and where it sits relative to the origin of the merged mesh. </summary>
+    struct MeshPart final
+    {
+        Ogre::String    mesh;       //!< The filename of the mesh.
+        Ogre::Vector3   offset;     //!< Added to every vertex position, rigid parts are only ever translated relative to their parent.
+    };
+
+    /// <summary>
+    /// Combines rigid meshes into a single mesh with one sub-mesh, so they need a single node, entity and batch. Vertices are rewritten with a
+    /// position, normal and texture coordinate each and only triangle lists are supported. The mesh is only built once per name.
+    /// </summary>
+    /// <param name="ogre"> The OgreApplication being rendered with. Nothing is built when headless or using the null render backend. </param>
+    /// <param name="name"> The name to give the merged mesh, this can then be passed to createEntity(). </param>
+    /// <param name="parts"> Every mesh to merge. </param>
+    /// <param name="material"> The material used by the whole merged mesh. </param>
+    /// <returns> Whether the merged mesh exists, when it doesn't each part must be drawn separately. </returns>
+    bool mergeMeshes (OgreApplication* const ogre, const Ogre::String& name, const std::vector<MeshPart>& parts, const Ogre::String& material);
 }
 
 
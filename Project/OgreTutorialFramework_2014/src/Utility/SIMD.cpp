@@ -0,0 +1,51 @@
+#include "SIMD.h"
+
+
+
+// STL headers.
+#include <cmath>
+#include <iostream>
+
+
+
+// Engine headers.
+#include <Badger/SpeedKernel.h>
+#include <Misc/TweenSystem.h>
+
+
+
+namespace simd
+{
+    bool compare (const char* const check, const float* const expected, const float* const actual, const std::size_t count, const float tolerance)
+    {
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            if (std::abs (expected[i] - actual[i]) > tolerance)
+            {
+                std::cerr << check << ", value " << i << " is " << actual[i] << " instead of " << expected[i] << "." << std::endl;
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+
+    bool verifyAll()
+    {
+        // A fast but wrong function is worthless.
+        if (!kernel::verifySpeedKernel())
+        {
+            std::cerr << "The vectorised speed integration doesn't match the scalar version." << std::endl;
+            return false;
+        }
+
+        if (!TweenSystem::verifyUpdate())
+        {
+            std::cerr << "The vectorised tween update doesn't match the scalar version." << std::endl;
+            return false;
+        }
+
+        return true;
+    }
+}
\ No newline at end of file
@@ -0,0 +1,38 @@
+#pragma once
+
+#ifndef _UTIL_SIMD_
+#define _UTIL_SIMD_
+
+
+// STL headers.
+#include <cstddef>
+
+
+// Vectorise wherever SSE2 is guaranteed, this is every x64 build and x86 builds using the default /arch:SSE2.
+#if defined (_M_X64) || (defined (_M_IX86_FP) && _M_IX86_FP >= 2) || defined (__SSE2__)
+    #define BADGER_SIMD 1
+    #include <emmintrin.h>
+#else
+    #define BADGER_SIMD 0
+#endif
+
+
+namespace simd
+{
+    /// <summary> The step lengths each vectorised function is verified over, varied so values pass through every case. </summary>
+    const float verificationSteps[] { 1.f / 60.f, 0.1f, 0.25f, 1.f / 120.f, 0.5f };
+
+
+    /// <summary> Compares the results of a vectorised function against its scalar version, reporting the first mismatch to std::cerr. </summary>
+    /// <param name="check"> The name of the verification, used in the report. </param>
+    /// <param name="expected"> The results of the scalar version. </param>
+    /// <param name="actual"> The results of the vectorised version. </param>
+    /// <returns> Whether every result was within the tolerance. </returns>
+    bool compare (const char* const check, const float* const expected, const float* const actual, const std::size_t count, const float tolerance);
+
+    /// <summary> Checks every vectorised function against its scalar version, this should be called before trusting their results. </summary>
+    /// <returns> Whether every function matched. </returns>
+    bool verifyAll();
+}
+
+#endif // _UTIL_SIMD_
\ No newline at end of file
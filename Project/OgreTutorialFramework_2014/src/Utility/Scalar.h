@@ -0,0 +1,111 @@
+#pragma once
+
+#ifndef _UTIL_SCALAR_
+#define _UTIL_SCALAR_
+
+
+// STL headers.
+#include <cmath>
+#include <type_traits>
+
+
+/// <summary>
+/// Scalar helpers without any Ogre dependency, so Ogre-free code such as VehicleModel and the speed kernel shares them with everything else.
+/// Utility/Maths.h includes this so the helpers are available wherever it's used.
+/// </summary>
+namespace util
+{
+    #pragma region Constants
+
+    const float pi      { 3.14159265f };    //!< The same value as Ogre::Math::PI.
+    const float twoPi   { pi * 2.f };       //!< A full revolution in radians.
+
+    #pragma endregion
+
+    #pragma region Comparison functions
+
+    /// <summary> Returns the minimum value, passed by value for arithmetic types. </summary>
+    template <typename T> typename std::enable_if<std::is_arithmetic<T>::value, T>::type min (const T a, const T b)
+    {
+        return a < b ? a : b;
+    }
+    
+
+    /// <summary> Returns the maximum value, passed by value for arithmetic types. </summary>
+    template <typename T> typename std::enable_if<std::is_arithmetic<T>::value, T>::type max (const T a, const T b)
+    {
+        return a > b ? a : b;
+    }
+
+
+    /// <summary> Returns the minimum value, passed by reference for non-arithmetic types. </summary>
+    template <typename T> typename std::enable_if<!std::is_arithmetic<T>::value, T>::type& min (const T& a, const T& b)
+    {
+        return a < b ? a : b;
+    }
+
+
+    /// <summary> Returns the maximum value, passed by reference for non-arithmetic types. </summary>
+    template <typename T> typename std::enable_if<!std::is_arithmetic<T>::value, T>::type& max (const T& a, const T& b)
+    {
+        return a > b ? a : b;
+    }
+    
+
+    /// <summary> Clamps a value between a given minimum and maximum value. Arithmetic types are passed by value. </summary>
+    /// <param name="value"> The value to clamp. </param>
+    template <typename T> typename std::enable_if<std::is_arithmetic<T>::value, T>::type clamp (const T value, const T min, const T max)
+    {
+        if (value < min)
+        {
+            return min;
+        }
+
+        if (value > max)
+        {
+            return max;
+        }
+
+        return value;
+    }
+
+
+    /// <summary> Clamps a value between a given minimum and maximum value. Non-arithmetic types are passed by reference. </summary>
+    /// <param name="value"> The value to clamp. </param>
+    template <typename T> typename std::enable_if<!std::is_arithmetic<T>::value, T>::type clamp (const T& value, const T& min, const T& max)
+    {
+        if (value < min)
+        {
+            return min;
+        }
+
+        if (value > max)
+        {
+            return max;
+        }
+
+        return value;
+    }
+
+    #pragma endregion
+
+    #pragma region Angle functions
+
+    /// <summary> Wraps an angle in radians between -PI and PI so accumulated angles don't lose precision. </summary>
+    inline float wrapAngle (const float angle)
+    {
+        return angle - twoPi * std::floor ((angle + pi) / twoPi);
+    }
+
+
+    /// <summary> Moves a value towards a target by no more than the given step, so it settles exactly on the target without overshooting. </summary>
+    /// <param name="maxStep"> The largest change allowed, this is expected to be positive. </param>
+    inline float approach (const float value, const float target, const float maxStep)
+    {
+        return value + clamp (target - value, -maxStep, maxStep);
+    }
+
+    #pragma endregion
+}
+
+#endif // _UTIL_SCALAR_
\ No newline at end of file
@@ -1,7 +1,12 @@
+#include <cstdlib>
 #include <iostream>
+#include <string>
 #include <Framework/OgreApplication.h>
 
-int main()
+static unsigned long DEFAULT_HEADLESS_FRAMES = 600;
+static double DEFAULT_FRAME_RATE = 60.0;
+
+int main(int argc, char* argv[])
 {
 	//show - hide console window
 	HWND hwnd = GetConsoleWindow();
@@ -9,17 +14,89 @@ int main()
 
 	shared_ptr<OgreApplication>  application = make_shared<OgreApplication>();
 
+	// "--null-renderer" runs without a window or GPU, "--frames <count>" exits after the given number of frames.
+	// "--time-scale <x>" fast-forwards the simulation, "--step-budget <ms>" limits the time spent stepping each frame and
+	// "--render-every <n>" only presents every nth frame. Together they allow long tracks to be soak-tested quickly.
+	// "--path <file>" loads the given path rather than asking for one, this is required when headless.
+	// "--fleet <count>" adds a fleet of badgers to the scene and "--instanced" draws it with hardware instancing, the batch count is reported on exit.
+	// "--fps <rate>" limits the frame rate, 0 removes the limit. Windows are limited to 60 frames per second by default, headless runs aren't limited.
+	// "--no-sim-thread" steps the simulation on the main thread between frames instead of on its own thread.
+	double frameRate = -1.0;
+
+	for (int i = 1; i < argc; ++i)
+	{
+		const std::string argument = argv[i];
+
+		if (argument == "--null-renderer")
+		{
+			application->SetRenderBackend(RenderBackend::Null);
+		}
+		else if (argument == "--frames" && i + 1 < argc)
+		{
+			application->SetFrameLimit(std::strtoul(argv[++i], nullptr, 10));
+		}
+		else if (argument == "--time-scale" && i + 1 < argc)
+		{
+			application->SetTimeScale(std::atof(argv[++i]));
+		}
+		else if (argument == "--step-budget" && i + 1 < argc)
+		{
+			application->SetStepBudget(std::atof(argv[++i]) / 1000.0);
+		}
+		else if (argument == "--render-every" && i + 1 < argc)
+		{
+			application->SetRenderInterval(std::strtoul(argv[++i], nullptr, 10));
+		}
+		else if (argument == "--fleet" && i + 1 < argc)
+		{
+			application->SetFleetSize(std::strtoul(argv[++i], nullptr, 10));
+		}
+		else if (argument == "--instanced")
+		{
+			application->SetFleetInstanced(true);
+		}
+		else if (argument == "--no-sim-thread")
+		{
+			application->SetThreadedSimulation(false);
+		}
+		else if (argument == "--fps" && i + 1 < argc)
+		{
+			frameRate = std::atof(argv[++i]);
+		}
+		else if (argument == "--path" && i + 1 < argc)
+		{
+			application->SetPathFile(argv[++i]);
+		}
+	}
+
+	// There's no window to close when headless.
+	if (application->IsHeadless() && application->GetFrameLimit() == 0)
+	{
+		application->SetFrameLimit(DEFAULT_HEADLESS_FRAMES);
+	}
+
+	// Nobody watches a headless run so it may as well go as fast as it can.
+	if (frameRate < 0.0)
+	{
+		frameRate = application->IsHeadless() ? 0.0 : DEFAULT_FRAME_RATE;
+	}
+
+	application->SetTargetFrameRate(frameRate);
+
 	// Step 1: Create and initialze the ogre application
 	if (application == nullptr || !application->Initialize())
 	{
 		std::cout << __FILE__ << " (" << __LINE__ << ") - " << "Failed to initialise the application" << std::endl;
-		system("PAUSE");
-		return 0;
+
+		// Nobody is there to press a key when headless.
+		if (!application->IsHeadless())
+		{
+			system("PAUSE");
+		}
+		return 1;
 	}
 
 	application->RunOgreApplication();
 	
 	return 0;
-}
-
-
+}
\ No newline at end of file